@@ -18,7 +18,10 @@
 #ifndef ASCII_LUT_H_
 #define ASCII_LUT_H_
 
-static const char ASCII[96][5] = {
+#include <avr/pgmspace.h>
+
+// Stored in flash, read with pgm_read_byte
+static const char ASCII[96][5] PROGMEM = {
 	{0x00, 0x00, 0x00, 0x00, 0x00} // 20  (space)
 	,{0x00, 0x00, 0x5f, 0x00, 0x00} // 21 !
 	,{0x00, 0x07, 0x00, 0x07, 0x00} // 22 "
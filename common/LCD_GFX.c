@@ -0,0 +1,549 @@
+/*
+ * LCD_GFX.c
+ *
+ * Created: 9/20/2021 6:54:25 PM
+ *  Author: You
+ */ 
+
+#include "LCD_GFX.h"
+#include "ST7735.h"
+#include <math.h>
+#include <avr/pgmspace.h>
+
+#if LCD_PROFILE
+#include <stdio.h>
+#include <string.h>
+
+static LCD_primitiveStats_t profileStats[LCD_PROF_COUNT];
+static uint8_t profileDepth;		// Nesting of profiled primitives
+
+static const char *const profileNames[LCD_PROF_COUNT] = {
+	"pixel", "char", "circle", "disk", "line", "block", "screen",
+	"string", "string2x", "bitmap", "sprite"
+};
+
+#define PROFILE_BEGIN()		LCD_counters_t profileStart; LCD_profileEnter(&profileStart)
+#define PROFILE_END(p)		LCD_profileLeave((p), &profileStart)
+#else
+#define PROFILE_BEGIN()
+#define PROFILE_END(p)
+#endif
+
+/******************************************************************************
+* Local Functions
+******************************************************************************/
+
+#if LCD_PROFILE
+/**************************************************************************//**
+* @fn			static void LCD_profileEnter(LCD_counters_t *start)
+* @brief		Take the start snapshot of the outermost profiled primitive
+* @note			Primitives called by other primitives are charged to the caller
+*****************************************************************************/
+static void LCD_profileEnter(LCD_counters_t *start)
+{
+	if (profileDepth++ == 0)
+	{
+		LCD_profileSnapshot(start);
+	}
+}
+
+/**************************************************************************//**
+* @fn			static void LCD_profileLeave(uint8_t primitive, const LCD_counters_t *start)
+* @brief		Charge the cycles and SPI traffic since start to a primitive
+* @note
+*****************************************************************************/
+static void LCD_profileLeave(uint8_t primitive, const LCD_counters_t *start)
+{
+	LCD_counters_t end;
+	LCD_primitiveStats_t *stats = &profileStats[primitive];
+
+	if (--profileDepth != 0)
+	{
+		return;
+	}
+
+	LCD_profileSnapshot(&end);
+	stats->calls++;
+	stats->cycles += end.cycles - start->cycles;
+	stats->bytes += end.bytes - start->bytes;
+	stats->windows += end.windows - start->windows;
+}
+#endif
+
+/**************************************************************************//**
+* @fn			static void LCD_fillSpan(short x0, short y0, short x1, short y1, uint16_t color)
+* @brief		Fill a clipped rectangle of the screen through one address window
+* @note			Corners may be given in any order and may lie off screen
+*****************************************************************************/
+static void LCD_fillSpan(short x0, short y0, short x1, short y1, uint16_t color)
+{
+	short t;
+	if (x0 > x1) { t = x0; x0 = x1; x1 = t; }
+	if (y0 > y1) { t = y0; y0 = y1; y1 = t; }
+
+	// Clip to the panel, skip anything fully off screen
+	if (x1 < 0 || y1 < 0 || x0 >= LCD_WIDTH || y0 >= LCD_HEIGHT) return;
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (x1 >= LCD_WIDTH) x1 = LCD_WIDTH - 1;
+	if (y1 >= LCD_HEIGHT) y1 = LCD_HEIGHT - 1;
+
+	LCD_openWindow(x0, y0, x1, y1);
+	LCD_pushColor(color, (uint16_t)(x1 - x0 + 1) * (uint16_t)(y1 - y0 + 1));
+	LCD_closeWindow();
+}
+
+
+/******************************************************************************
+* Global Functions
+******************************************************************************/
+
+/**************************************************************************//**
+* @fn			uint16_t rgb565(uint8_t red, uint8_t green, uint8_t blue)
+* @brief		Convert RGB888 value to RGB565 16-bit color data
+* @note
+*****************************************************************************/
+uint16_t rgb565(uint8_t red, uint8_t green, uint8_t blue)
+{
+	return ((((31*(red+4))/255)<<11) | (((63*(green+2))/255)<<5) | ((31*(blue+4))/255));
+}
+
+/**************************************************************************//**
+* @fn			void LCD_drawPixel(uint8_t x, uint8_t y, uint16_t color)
+* @brief		Draw a single pixel of 16-bit rgb565 color to the x & y coordinate
+* @note
+*****************************************************************************/
+void LCD_drawPixel(uint8_t x, uint8_t y, uint16_t color) {
+	PROFILE_BEGIN();
+	LCD_openWindow(x,y,x,y);
+	SPI_ControllerTx_16bit_stream(color);
+	LCD_closeWindow();
+	PROFILE_END(LCD_PROF_PIXEL);
+}
+
+/**************************************************************************//**
+* @fn			static void LCD_blitGlyph(uint8_t x, uint8_t y, uint16_t character, uint16_t fColor, uint16_t bColor, uint8_t width)
+* @brief		Stream a glyph cell from the flash font into one address window
+* @note			Each font column is read from PROGMEM once. A width of 6 adds
+*				the spacing column in the background color.
+*****************************************************************************/
+static void LCD_blitGlyph(uint8_t x, uint8_t y, uint16_t character, uint16_t fColor, uint16_t bColor, uint8_t width){
+	uint8_t columns[GLYPH_CELL_WIDTH];
+	uint8_t i, mask;
+	const char *glyph;
+	
+	if (character < 0x20 || character > 0x7F){
+		character = ' ';		//Outside the table, draw a blank cell
+	}
+	glyph = ASCII[character - 0x20];	//Row of ASCII table starting at space
+	
+	for(i=0;i<GLYPH_WIDTH;i++){
+		columns[i] = pgm_read_byte(&glyph[i]);
+	}
+	columns[GLYPH_WIDTH] = 0x00;	//Spacing column
+	
+	LCD_openWindow(x, y, x+width-1, y+GLYPH_HEIGHT-1);
+	for(mask=0x01;mask!=0;mask<<=1){	//One pass per pixel row, top to bottom
+		for(i=0;i<width;i++){
+			SPI_ControllerTx_16bit_stream((columns[i] & mask) ? fColor : bColor);
+		}
+	}
+	LCD_closeWindow();
+}
+
+/**************************************************************************//**
+* @fn			static void LCD_blitGlyphScaled(uint8_t x, uint8_t y, uint16_t character, uint8_t scale, uint16_t fColor, uint16_t bColor)
+* @brief		Stream a scaled 6x8 glyph cell into one address window
+* @note			Each font row is split into runs of equal color and every run is
+*				sent with one LCD_pushColor call, repeated for the scale rows
+*****************************************************************************/
+static void LCD_blitGlyphScaled(uint8_t x, uint8_t y, uint16_t character, uint8_t scale, uint16_t fColor, uint16_t bColor){
+	uint8_t columns[GLYPH_CELL_WIDTH];
+	uint8_t i, run, rep, mask, lit;
+	const char *glyph;
+	
+	if (character < 0x20 || character > 0x7F){
+		character = ' ';		//Outside the table, draw a blank cell
+	}
+	glyph = ASCII[character - 0x20];	//Row of ASCII table starting at space
+	
+	for(i=0;i<GLYPH_WIDTH;i++){
+		columns[i] = pgm_read_byte(&glyph[i]);
+	}
+	columns[GLYPH_WIDTH] = 0x00;	//Spacing column
+	
+	LCD_openWindow(x, y, x+GLYPH_CELL_WIDTH*scale-1, y+GLYPH_HEIGHT*scale-1);
+	for(mask=0x01;mask!=0;mask<<=1){
+		for(rep=0;rep<scale;rep++){
+			i = 0;
+			while(i<GLYPH_CELL_WIDTH){
+				lit = columns[i] & mask;
+				run = 1;
+				while((i+run<GLYPH_CELL_WIDTH)&&(((columns[i+run] & mask)!=0)==(lit!=0))){
+					run++;
+				}
+				LCD_pushColor(lit ? fColor : bColor, run*scale);
+				i += run;
+			}
+		}
+	}
+	LCD_closeWindow();
+}
+
+/**************************************************************************//**
+* @fn			void LCD_drawChar(uint8_t x, uint8_t y, uint16_t character, uint16_t fColor, uint16_t bColor)
+* @brief		Draw a character starting at the point with foreground and background colors
+* @note			The 5x8 glyph is streamed row by row into a single address window
+*****************************************************************************/
+void LCD_drawChar(uint8_t x, uint8_t y, uint16_t character, uint16_t fColor, uint16_t bColor){
+	PROFILE_BEGIN();
+	if ((LCD_WIDTH-x>7)&&(LCD_HEIGHT-y>7)){
+		LCD_blitGlyph(x, y, character, fColor, bColor, GLYPH_WIDTH);
+	}
+	PROFILE_END(LCD_PROF_CHAR);
+}
+
+
+/******************************************************************************
+* LAB 4 TO DO. COMPLETE THE FUNCTIONS BELOW.
+* You are free to create and add any additional files, libraries, and/or
+*  helper function. All code must be authentically yours.
+******************************************************************************/
+
+/**************************************************************************//**
+* @fn			void LCD_drawCircle(uint8_t x0, uint8_t y0, uint8_t radius,uint16_t color)
+* @brief		Draw a colored circle of set radius at coordinates
+* @note
+*****************************************************************************/
+void LCD_drawCircle(uint8_t x0, uint8_t y0, uint8_t radius,uint16_t color)
+{
+	PROFILE_BEGIN();
+	int x = radius;
+    int y = 0;
+    int err = 0;
+
+    while (x >= y)
+    {
+        // Bresenham circle algorithm
+        LCD_drawPixel(x0 + x, y0 + y, color);
+        LCD_drawPixel(x0 + y, y0 + x, color);
+        LCD_drawPixel(x0 - y, y0 + x, color);
+        LCD_drawPixel(x0 - x, y0 + y, color);
+        LCD_drawPixel(x0 - x, y0 - y, color);
+        LCD_drawPixel(x0 - y, y0 - x, color);
+        LCD_drawPixel(x0 + y, y0 - x, color);
+        LCD_drawPixel(x0 + x, y0 - y, color);
+        
+        if (err <= 0)
+        {
+            y += 1;
+            err += 2*y + 1;
+        } else {
+            x -= 1;
+            err -= 2*x + 1;
+        }
+    }
+	PROFILE_END(LCD_PROF_CIRCLE);
+}
+
+/**************************************************************************//**
+* @fn			void LCD_drawDisk(uint8_t x0, uint8_t y0, uint8_t radius,uint16_t color)
+* @brief		Draw a filled circle of set radius at coordinates
+* @note			Each scanline of the disk is sent as one horizontal span
+*****************************************************************************/
+void LCD_drawDisk(uint8_t x0, uint8_t y0, uint8_t radius, uint16_t color)
+{
+	PROFILE_BEGIN();
+    int x = radius;
+    int y = 0;
+    int err = 0;
+
+    while (x >= y)
+    {
+        LCD_fillSpan(x0 - x, y0 + y, x0 + x, y0 + y, color); // Lower half
+        LCD_fillSpan(x0 - x, y0 - y, x0 + x, y0 - y, color); // Upper half
+        LCD_fillSpan(x0 - y, y0 + x, x0 + y, y0 + x, color); // Lower half
+        LCD_fillSpan(x0 - y, y0 - x, x0 + y, y0 - x, color); // Upper half
+        
+        if (err <= 0)
+        {
+            y += 1;
+            err += 2*y + 1;
+        }
+        else
+        {
+            x -= 1;
+            err -= 2*x + 1;
+        }
+    }
+	PROFILE_END(LCD_PROF_DISK);
+}
+
+
+
+/**************************************************************************//**
+* @fn			void LCD_drawLine(short x0,short y0,short x1,short y1,uint16_t c)
+* @brief		Draw a line from and to a point with a color
+* @note			Straight runs of the line are sent as spans instead of pixels
+*****************************************************************************/
+void LCD_drawLine(short x0,short y0,short x1,short y1,uint16_t c)
+{
+	PROFILE_BEGIN();
+	// Horizontal and vertical lines are a single span
+	if (x0 == x1 || y0 == y1)
+	{
+		LCD_fillSpan(x0, y0, x1, y1, c);
+		PROFILE_END(LCD_PROF_LINE);
+		return;
+	}
+
+	// Bresenham line algorithm
+    
+    // abs
+    short dx = (x1 - x0 >= 0) ? x1 - x0 : x0 - x1;
+    
+    // -abs
+    short dy = (y1 - y0 >= 0) ? y0 - y1 : y1 - y0;
+    short sx = x0 < x1 ? 1 : -1;
+    short sy = y0 < y1 ? 1 : -1;
+    short err = dx + dy;
+    short e2;
+
+    // A run keeps going while only the major axis steps
+    uint8_t xMajor = (dx >= -dy);
+    short rx = x0, ry = y0;	// Start of the current run
+    short px, py;			// Last pixel of the current run
+
+    while (1)
+    {
+        if (x0 == x1 && y0 == y1)
+            break;
+            
+        px = x0;
+        py = y0;
+        e2 = 2 * err;
+        
+        if (e2 >= dy)
+        {
+            if (x0 == x1)
+                break;
+            err += dy;
+            x0 += sx;
+        }
+        
+        if (e2 <= dx)
+        {
+            if (y0 == y1)
+                break;
+            err += dx;
+            y0 += sy;
+        }
+
+        // Minor axis stepped, so the run ended on the previous pixel
+        if ((xMajor && y0 != py) || (!xMajor && x0 != px))
+        {
+            LCD_fillSpan(rx, ry, px, py, c);
+            rx = x0;
+            ry = y0;
+        }
+    }
+
+    LCD_fillSpan(rx, ry, x0, y0, c);
+	PROFILE_END(LCD_PROF_LINE);
+}
+
+
+
+/**************************************************************************//**
+* @fn			void LCD_drawBlock(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1,uint16_t color)
+* @brief		Draw a colored block at coordinates
+* @note			Both corners are inclusive
+*****************************************************************************/
+void LCD_drawBlock(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1,uint16_t color)
+{
+	PROFILE_BEGIN();
+	LCD_fillSpan(x0, y0, x1, y1, color);
+	PROFILE_END(LCD_PROF_BLOCK);
+}
+
+/**************************************************************************//**
+* @fn			void LCD_setScreen(uint16_t color)
+* @brief		Draw the entire screen to a color
+* @note			All LCD_WIDTH x LCD_HEIGHT pixels are streamed through one window
+*****************************************************************************/
+void LCD_setScreen(uint16_t color) 
+{
+	PROFILE_BEGIN();
+	LCD_fillSpan(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1, color);
+	PROFILE_END(LCD_PROF_SCREEN);
+}
+
+/**************************************************************************//**
+* @fn			void LCD_drawString(uint8_t x, uint8_t y, char* str, uint16_t fg, uint16_t bg)
+* @brief		Draw a string starting at the point with foreground and background colors
+* @note			Each character is one 6x8 window including its spacing column,
+*				drawing stops at the first cell that does not fit
+*****************************************************************************/
+void LCD_drawString(uint8_t x, uint8_t y, char* str, uint16_t fg, uint16_t bg)
+{
+	PROFILE_BEGIN();
+	uint8_t i = 0;
+    while (str[i] != '\0')
+    {
+        // Each character is a 6x8 cell, 5 pixels wide + 1 pixel spacing
+        uint8_t cx = x + (i * GLYPH_CELL_WIDTH);
+        if ((LCD_WIDTH-cx<GLYPH_CELL_WIDTH)||(LCD_HEIGHT-y<GLYPH_HEIGHT))
+        {
+            break;
+        }
+        LCD_blitGlyph(cx, y, str[i], fg, bg, GLYPH_CELL_WIDTH);
+        i++;
+    }
+	PROFILE_END(LCD_PROF_STRING);
+}
+
+/**************************************************************************//**
+* @fn			void LCD_drawStringScaled(uint8_t x, uint8_t y, char* str, uint8_t scale, uint16_t fg, uint16_t bg)
+* @brief		Draw a string with every font pixel enlarged to scale x scale
+* @note			A scale of 1 is LCD_drawString. Each character is one window of
+*				6*scale x 8*scale, drawing stops at the first cell that does not fit
+*****************************************************************************/
+void LCD_drawStringScaled(uint8_t x, uint8_t y, char* str, uint8_t scale, uint16_t fg, uint16_t bg)
+{
+	PROFILE_BEGIN();
+	uint8_t cellWidth = GLYPH_CELL_WIDTH * scale;
+	uint8_t cellHeight = GLYPH_HEIGHT * scale;
+	uint8_t i = 0;
+	
+	if (scale <= 1)
+	{
+		LCD_drawString(x, y, str, fg, bg);
+		PROFILE_END(LCD_PROF_STRING_SCALED);
+		return;
+	}
+	
+	while (str[i] != '\0')
+	{
+		uint16_t cx = x + (uint16_t)i * cellWidth;
+		if ((cx + cellWidth > LCD_WIDTH)||(y + cellHeight > LCD_HEIGHT))
+		{
+			break;
+		}
+		LCD_blitGlyphScaled(cx, y, str[i], scale, fg, bg);
+		i++;
+	}
+	PROFILE_END(LCD_PROF_STRING_SCALED);
+}
+
+/**************************************************************************//**
+* @fn			void LCD_drawBitmap(uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint16_t *pixels)
+* @brief		Draw an uncompressed RGB565 bitmap stored in flash
+* @note			Pixels are row-major and streamed into one address window
+*****************************************************************************/
+void LCD_drawBitmap(uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint16_t *pixels)
+{
+	PROFILE_BEGIN();
+	uint16_t count = (uint16_t)width * height;
+	
+	if ((width == 0)||(height == 0)||(x + width > LCD_WIDTH)||(y + height > LCD_HEIGHT))
+	{
+		PROFILE_END(LCD_PROF_BITMAP);
+		return;
+	}
+	
+	LCD_openWindow(x, y, x+width-1, y+height-1);
+	while (count--)
+	{
+		SPI_ControllerTx_16bit_stream(pgm_read_word(pixels++));
+	}
+	LCD_closeWindow();
+	PROFILE_END(LCD_PROF_BITMAP);
+}
+
+/**************************************************************************//**
+* @fn			void LCD_drawBitmapRLE(uint8_t x, uint8_t y, const LCD_sprite_t *sprite)
+* @brief		Draw a palette-indexed, run-length-encoded sprite stored in flash
+* @note			The palette is copied to the stack once, then every run is a
+*				single LCD_pushColor into the sprite's address window
+*****************************************************************************/
+void LCD_drawBitmapRLE(uint8_t x, uint8_t y, const LCD_sprite_t *sprite)
+{
+	PROFILE_BEGIN();
+	LCD_sprite_t s;
+	uint16_t palette[16];
+	const uint8_t *runs;
+	uint16_t i;
+	uint8_t run;
+	
+	memcpy_P(&s, sprite, sizeof(s));
+	if ((s.width == 0)||(s.height == 0)||(x + s.width > LCD_WIDTH)||(y + s.height > LCD_HEIGHT))
+	{
+		PROFILE_END(LCD_PROF_BITMAP_RLE);
+		return;
+	}
+	
+	for (i = 0; i < s.colors && i < 16; i++)
+	{
+		palette[i] = pgm_read_word(&s.palette[i]);
+	}
+	
+	runs = s.runs;
+	LCD_openWindow(x, y, x+s.width-1, y+s.height-1);
+	for (i = 0; i < s.runCount; i++)
+	{
+		run = pgm_read_byte(runs++);
+		LCD_pushColor(palette[run & 0x0F], (run >> 4) + 1);
+	}
+	LCD_closeWindow();
+	PROFILE_END(LCD_PROF_BITMAP_RLE);
+}
+
+#if LCD_PROFILE
+/**************************************************************************//**
+* @fn			void LCD_profileReset(void)
+* @brief		Clear the per-primitive statistics
+* @note
+*****************************************************************************/
+void LCD_profileReset(void)
+{
+	memset(profileStats, 0, sizeof(profileStats));
+}
+
+/**************************************************************************//**
+* @fn			void LCD_profileGet(uint8_t primitive, LCD_primitiveStats_t *stats)
+* @brief		Copy the statistics of one primitive, see LCD_primitive_t
+* @note
+*****************************************************************************/
+void LCD_profileGet(uint8_t primitive, LCD_primitiveStats_t *stats)
+{
+	if (primitive < LCD_PROF_COUNT)
+	{
+		*stats = profileStats[primitive];
+	}
+}
+
+/**************************************************************************//**
+* @fn			void LCD_profilePrint(void)
+* @brief		Print one line per primitive that was used since the last reset
+* @note			Times are in microseconds at F_CPU, per call on average
+*****************************************************************************/
+void LCD_profilePrint(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < LCD_PROF_COUNT; i++)
+	{
+		const LCD_primitiveStats_t *stats = &profileStats[i];
+
+		if (stats->calls == 0)
+		{
+			continue;
+		}
+		printf("  %-9s calls %5u, %7lu us, avg %6lu us, %6lu B, %4lu windows\r\n",
+			   profileNames[i], stats->calls,
+			   stats->cycles / (F_CPU / 1000000UL),
+			   stats->cycles / (F_CPU / 1000000UL) / stats->calls,
+			   stats->bytes, stats->windows);
+	}
+}
+#endif
@@ -0,0 +1,82 @@
+/*
+ * LCD_GFX.h
+ *
+ * Created: 9/20/2021 6:54:37 PM
+ *  Author: You
+ */ 
+
+#include <avr/io.h>
+#include "ASCII_LUT.h"
+#include "ST7735.h"
+
+#ifndef LCD_GFX_H_
+#define LCD_GFX_H_
+
+// font cell geometry
+#define GLYPH_WIDTH       5
+#define GLYPH_HEIGHT      8
+#define GLYPH_CELL_WIDTH  6
+
+// palette-indexed, run-length-encoded sprite in flash, see tools/png2sprite.py
+// each run byte is (length - 1) << 4 | palette index, runs wrap across rows
+typedef struct {
+	uint8_t width;
+	uint8_t height;
+	uint8_t colors;				// palette entries, 1 to 16
+	const uint16_t *palette;	// RGB565 colors in flash
+	const uint8_t *runs;		// run bytes in flash
+	uint16_t runCount;
+} LCD_sprite_t;
+
+// colors
+#define	BLACK     0x0000
+#define WHITE     0xFFFF
+#define	BLUE      0x001F
+#define	RED       0xF800
+#define	GREEN     0x07E0
+#define CYAN      0x07FF
+#define MAGENTA   0xF81F
+#define YELLOW    0xFFE0
+
+uint16_t rgb565(uint8_t red, uint8_t green, uint8_t blue);
+void LCD_drawPixel(uint8_t x, uint8_t y, uint16_t color);
+void LCD_drawChar(uint8_t x, uint8_t y, uint16_t character, uint16_t fColor, uint16_t bColor);
+void LCD_drawCircle(uint8_t x0, uint8_t y0, uint8_t radius,uint16_t color);
+void LCD_drawDisk(uint8_t x0, uint8_t y0, uint8_t radius,uint16_t color);
+void LCD_drawLine(short x0,short y0,short x1,short y1,uint16_t c);
+void LCD_drawBlock(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1,uint16_t color);
+void LCD_setScreen(uint16_t color);
+void LCD_drawString(uint8_t x, uint8_t y, char* str, uint16_t fg, uint16_t bg);
+void LCD_drawStringScaled(uint8_t x, uint8_t y, char* str, uint8_t scale, uint16_t fg, uint16_t bg);
+void LCD_drawBitmap(uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint16_t *pixels);
+void LCD_drawBitmapRLE(uint8_t x, uint8_t y, const LCD_sprite_t *sprite);
+
+#if LCD_PROFILE
+// primitives with their own statistics, nested calls are charged to the outer one
+typedef enum {
+	LCD_PROF_PIXEL,
+	LCD_PROF_CHAR,
+	LCD_PROF_CIRCLE,
+	LCD_PROF_DISK,
+	LCD_PROF_LINE,
+	LCD_PROF_BLOCK,
+	LCD_PROF_SCREEN,
+	LCD_PROF_STRING,
+	LCD_PROF_STRING_SCALED,
+	LCD_PROF_BITMAP,
+	LCD_PROF_BITMAP_RLE,
+	LCD_PROF_COUNT
+} LCD_primitive_t;
+
+typedef struct {
+	uint16_t calls;
+	uint32_t cycles;
+	uint32_t bytes;
+	uint32_t windows;
+} LCD_primitiveStats_t;
+
+void LCD_profileReset(void);
+void LCD_profileGet(uint8_t primitive, LCD_primitiveStats_t *stats);
+void LCD_profilePrint(void);
+#endif
+#endif /* LCD_GFX_H_ */
\ No newline at end of file
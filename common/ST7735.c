@@ -0,0 +1,464 @@
+/**************************************************************************//**
+* @file        ST7735.c
+* @ingroup 	   ST7735
+* @brief       Basic display driver for Adafruit 358 1.8" TFT LCD with ST7735R chip
+*
+* @details     Basic display driver for Adafruit 358 1.8" TFT LCD with ST7735R chip
+*
+*
+* @copyright
+* @author	   J. Ye
+* @date        April 19, 2021
+* @version		1.0
+*****************************************************************************/
+
+#include "drivers_config.h"
+#include <avr/io.h>
+#include <util/delay.h>
+#include <avr/pgmspace.h>
+#include "ST7735.h"
+
+#if LCD_PROFILE
+#include <avr/interrupt.h>
+
+static uint32_t profileBytes;		// SPI bytes sent
+static uint32_t profileWindows;		// Address windows opened
+static volatile uint16_t profileOverflows;	// Upper half of the cycle counter
+
+#define PROFILE_BYTES(n)	(profileBytes += (n))
+#define PROFILE_WINDOW()	(profileWindows++)
+#else
+#define PROFILE_BYTES(n)
+#define PROFILE_WINDOW()
+#endif
+
+/******************************************************************************
+* Local Functions
+******************************************************************************/
+
+/**************************************************************************//**
+* @fn			static void lcd_pin_init(void)
+* @brief		Initialize SPI for LCD
+* @note
+*****************************************************************************/
+static void lcd_pin_init(void)
+{
+	//Setup digital pins
+	LCD_DDR |= (1<<LCD_DC)|(1<<LCD_RST)|(1<<LCD_TFT_CS)|(1<<LCD_MOSI)|(1<<LCD_SCK);	//Set up output pins
+	LCD_LITE_DDR |= (1<<LCD_LITE);	//Set up output pins
+
+	//Setup PWM for LCD Backlight
+	TCCR0A |= (1<<COM0A1)|(1<<WGM01)|(1<<WGM00);	//Fast PWM: clear OC0A on match, set at bottom
+	TCCR0B |= (1<<CS02);	//clk/1024/256=244Hz
+	OCR0A = 127;	//Set starting PWM value
+
+	//Enable LCD by setting RST high
+	_delay_ms(50);
+	set(LCD_PORT, LCD_RST);
+}
+
+/**************************************************************************//**
+* @fn			static void SPI_Controller_Init(void)
+* @brief		Initialize SPI for LCD
+* @note
+*****************************************************************************/
+static void SPI_Controller_Init(void)
+{
+	SPCR0 = (1<<SPE) | (1<<MSTR);		//Enable SPI, Master, set clock rate fck/64
+	SPSR0 = (1<<SPI2X);										//SPI 2X speed
+
+	//Every write waits for SPIF first, so clock out one NOP with CS high to set it
+	set(LCD_PORT, LCD_TFT_CS);
+	SPDR0 = ST7735_NOP;
+}
+
+/**************************************************************************//**
+* @fn			static inline void SPI_ControllerWait(void)
+* @brief		Wait until the byte in flight has been clocked out
+* @note			Needed before CS or D/C change. Only reads SPSR0, so SPIF stays
+*				set and the next SPI_ControllerPut() does not wait again.
+*****************************************************************************/
+static inline void SPI_ControllerWait(void)
+{
+	while(!(SPSR0 & (1<<SPIF)));	//wait for end of transmission
+}
+
+/**************************************************************************//**
+* @fn			static inline void SPI_ControllerPut(uint8_t data)
+* @brief		Start sending a byte as soon as the previous one is out
+* @note			Returns while the byte is still being clocked out, so the caller
+*				prepares the next byte in the 16 cycles it takes at fck/2.
+*				Reading SPSR0 with SPIF set and then writing SPDR0 clears SPIF.
+*****************************************************************************/
+static inline void SPI_ControllerPut(uint8_t data)
+{
+	SPI_ControllerWait();
+	SPDR0 = data;		//Place data to be sent on registers
+}
+
+
+/**************************************************************************//**
+* @fn			static uint8_t readCommandByte(const uint8_t *cmds, uint8_t fromFlash)
+* @brief		Read one byte of a command array from RAM or flash
+* @note
+*****************************************************************************/
+static inline uint8_t readCommandByte(const uint8_t *cmds, uint8_t fromFlash)
+{
+	return fromFlash ? pgm_read_byte(cmds) : *cmds;
+}
+
+/**************************************************************************//**
+* @fn			static void sendCommandList(const uint8_t *cmds, uint8_t length, uint8_t fromFlash)
+* @brief		Parse and send array of commands thru SPI
+* @note			Shared by sendCommands and sendCommands_P
+*****************************************************************************/
+static void sendCommandList(const uint8_t *cmds, uint8_t length, uint8_t fromFlash)
+{
+	//Command array structure:
+	//Command Code, # of data bytes, data bytes (if any), delay in ms
+	uint8_t numCommands, numData, waitTime;
+
+	numCommands = length;	// # of commands to send
+
+	clear(LCD_PORT, LCD_TFT_CS);	//CS pulled low to start communication
+
+	while (numCommands--)	// Send each command
+	{
+		SPI_ControllerWait();
+		clear(LCD_PORT, LCD_DC);	//D/C pulled low for command
+		
+		SPI_ControllerTx_stream(readCommandByte(cmds++, fromFlash));
+		
+		numData = readCommandByte(cmds++, fromFlash);	// # of data bytes to send
+
+		SPI_ControllerWait();
+		set(LCD_PORT, LCD_DC);	//D/C set high for data
+		while (numData--)	// Send each data byte...
+		{
+			SPI_ControllerTx_stream(readCommandByte(cmds++, fromFlash));
+			
+		}
+
+		waitTime = readCommandByte(cmds++, fromFlash);     // Read post-command delay time (ms)
+		if (waitTime!=0)
+		{
+			Delay_ms((waitTime==255 ? 500 : waitTime));
+		}
+	}
+
+	SPI_ControllerWait();
+	set(LCD_PORT, LCD_TFT_CS);	//set CS to high
+}
+
+/******************************************************************************
+* Global Functions
+******************************************************************************/
+
+/**************************************************************************//**
+* @fn			void Delay_ms(unsigned int n)
+* @brief		Delay function using variables
+* @note
+*****************************************************************************/
+void Delay_ms(unsigned int n)
+{
+	while (n--)
+	{
+		_delay_ms(1);
+	}
+}
+
+/**************************************************************************//**
+* @fn			void SPI_ControllerTx(uint8_t data)
+* @brief		Send 8-bit SPI data to peripheral
+* @note
+*****************************************************************************/
+void SPI_ControllerTx(uint8_t data)
+{
+	clear(LCD_PORT, LCD_TFT_CS);	//CS pulled low to start communication
+
+	SPI_ControllerTx_stream(data);
+
+	SPI_ControllerWait();
+	set(LCD_PORT, LCD_TFT_CS);	//set CS to high
+}
+
+/**************************************************************************//**
+* @fn			void SPI_ControllerTx_stream(uint8_t stream)
+* @brief		Send a command to LCD through SPI without setting CS or DC
+* @note			Returns before the byte is out, see SPI_ControllerPut()
+*****************************************************************************/
+void SPI_ControllerTx_stream(uint8_t stream)
+{
+	SPI_ControllerPut(stream);
+	PROFILE_BYTES(1);
+}
+
+/**************************************************************************//**
+* @fn			void SPI_ControllerTx_16bit(uint16_t data)
+* @brief		Send 16-bit data to peripheral
+* @note			Used for color information
+*****************************************************************************/
+void SPI_ControllerTx_16bit(uint16_t data)
+{
+	clear(LCD_PORT, LCD_TFT_CS);	//CS pulled low to start communication
+	
+	SPI_ControllerPut(data >> 8);
+	SPI_ControllerPut(data);
+	PROFILE_BYTES(2);
+	
+	SPI_ControllerWait();
+	set(LCD_PORT, LCD_TFT_CS);	//set CS to high
+}
+
+/**************************************************************************//**
+* @fn			void SPI_ControllerTx_16bit_stream(uint16_t data)
+* @brief		Send 16 bit data to LCD through SPI without setting CS or DC
+* @note			Used for color information. Returns before the low byte is out,
+*				so the caller computes the next pixel while it is clocked out.
+*****************************************************************************/
+void SPI_ControllerTx_16bit_stream(uint16_t data)
+{
+	SPI_ControllerPut(data >> 8);
+	SPI_ControllerPut(data);
+	PROFILE_BYTES(2);
+}
+
+/**************************************************************************//**
+* @fn			void lcd_init(void)
+* @brief		Initialize LCD settings
+* @note
+*****************************************************************************/
+void lcd_init(void)
+{
+	lcd_pin_init();
+	SPI_Controller_Init();
+	_delay_ms(5);
+
+	static const uint8_t ST7735_cmds[] PROGMEM =
+	{
+		ST7735_SWRESET, 0, 150,       // Software reset. This first one is needed because of the RC reset.
+		ST7735_SLPOUT, 0, 255,       // Exit sleep mode
+		ST7735_FRMCTR1, 3, 0x01, 0x2C, 0x2D, 0,  // Frame rate control 1
+		ST7735_FRMCTR2, 3, 0x01, 0x2C, 0x2D, 0,  // Frame rate control 2
+		ST7735_FRMCTR3, 6, 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D, 0,  // Frame rate control 3
+		ST7735_INVCTR, 1, 0x07, 0,	// Display inversion
+		ST7735_PWCTR1, 3, 0x0A, 0x02, 0x84, 5, // Power control 1
+		ST7735_PWCTR2, 1, 0xC5, 5,       // Power control 2
+		ST7735_PWCTR3, 2, 0x0A, 0x00, 5,	// Power control 3
+		ST7735_PWCTR4, 2, 0x8A, 0x2A, 5,	// Power control 4
+		ST7735_PWCTR5, 2, 0x8A, 0xEE, 5,	// Power control 5
+		ST7735_VMCTR1, 1, 0x0E, 0, // Vcom control 1
+		ST7735_INVOFF, 0, 0,	//Inversion off
+		ST7735_MADCTL, 1, 0xC8, 0,	//Memory Access control
+		ST7735_COLMOD, 1, 0x05, 0,	//Interface pixel format
+		ST7735_CASET, 4, 0x00, 0x00, 0x00, 0x7F, 0,		//Column
+		ST7735_RASET, 4, 0x00, 0x00, 0x00, 0x9F, 0,		//Page
+		ST7735_GMCTRP1, 16, 0x02, 0x1C, 0x07, 0x12, 0x37, 0x32, 0x29, 0x2D,
+		0x29, 0x25, 0x2B, 0x39, 0x00, 0x01, 0x03, 0x10, 0, // Positive Gamma
+		ST7735_GMCTRN1, 16, 0x03, 0x1D, 0x07, 0x06, 0x2E, 0x2C, 0x29,0x2D,
+		0x2E, 0x2E, 0x37, 0x3F, 0x00, 0x00, 0x02, 0x10, 0, // Negative Gamma
+		ST7735_NORON, 0, 10,	//Normal display on
+		ST7735_DISPON, 0, 100,            // Set display on
+		ST7735_MADCTL, 1, MADCTL_MX | MADCTL_MV | MADCTL_RGB, 10		//Default to rotation 3
+	};
+
+	sendCommands_P(ST7735_cmds, 22);
+}
+
+/**************************************************************************//**
+* @fn			void sendCommands (const uint8_t *cmds, uint8_t length)
+* @brief		Parse and send array of commands thru SPI
+* @note			Command array is in RAM
+*****************************************************************************/
+void sendCommands (const uint8_t *cmds, uint8_t length)
+{
+	sendCommandList(cmds, length, 0);
+}
+
+/**************************************************************************//**
+* @fn			void sendCommands_P (const uint8_t *cmds, uint8_t length)
+* @brief		Parse and send array of commands thru SPI
+* @note			Command array is in flash (PROGMEM)
+*****************************************************************************/
+void sendCommands_P (const uint8_t *cmds, uint8_t length)
+{
+	sendCommandList(cmds, length, 1);
+}
+
+/**************************************************************************//**
+* @fn			void LCD_setAddr(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+* @brief		Set pixel memory address to write to
+* @note			RAMWR needs no settling time, so no post-command delay is used
+*****************************************************************************/
+void LCD_setAddr(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+	LCD_openWindow(x0, y0, x1, y1);
+	LCD_closeWindow();
+}
+
+/**************************************************************************//**
+* @fn			void LCD_openWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+* @brief		Set pixel memory address and keep CS low for streaming pixel data
+* @note			Pixels fill the window row by row. Follow with LCD_closeWindow()
+*****************************************************************************/
+void LCD_openWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+	PROFILE_WINDOW();
+	clear(LCD_PORT, LCD_TFT_CS);	//CS pulled low to start communication
+
+	//D/C may only change once the byte before it is out
+	clear(LCD_PORT, LCD_DC);	//D/C pulled low for command
+	SPI_ControllerTx_stream(ST7735_CASET);	// Column
+	SPI_ControllerWait();
+	set(LCD_PORT, LCD_DC);	//D/C set high for data
+	SPI_ControllerTx_stream(0x00);
+	SPI_ControllerTx_stream(x0);
+	SPI_ControllerTx_stream(0x00);
+	SPI_ControllerTx_stream(x1);
+
+	SPI_ControllerWait();
+	clear(LCD_PORT, LCD_DC);
+	SPI_ControllerTx_stream(ST7735_RASET);	// Page
+	SPI_ControllerWait();
+	set(LCD_PORT, LCD_DC);
+	SPI_ControllerTx_stream(0x00);
+	SPI_ControllerTx_stream(y0);
+	SPI_ControllerTx_stream(0x00);
+	SPI_ControllerTx_stream(y1);
+
+	SPI_ControllerWait();
+	clear(LCD_PORT, LCD_DC);
+	SPI_ControllerTx_stream(ST7735_RAMWR);	// Into RAM
+	SPI_ControllerWait();
+	set(LCD_PORT, LCD_DC);	//Leave D/C high, everything after this is pixel data
+}
+
+/**************************************************************************//**
+* @fn			void LCD_closeWindow(void)
+* @brief		End a pixel stream started with LCD_openWindow()
+* @note			Waits for the last pixel byte before releasing CS
+*****************************************************************************/
+void LCD_closeWindow(void)
+{
+	SPI_ControllerWait();
+	set(LCD_PORT, LCD_TFT_CS);	//set CS to high
+}
+
+/**************************************************************************//**
+* @fn			void LCD_pushColor(uint16_t color, uint16_t count)
+* @brief		Stream the same 16-bit color count times into the open window
+* @note			CS must already be held low by LCD_openWindow()
+*****************************************************************************/
+void LCD_pushColor(uint16_t color, uint16_t count)
+{
+	uint8_t hi = color >> 8;
+	uint8_t lo = color;
+
+	PROFILE_BYTES(2UL * count);
+	while (count--)
+	{
+		//The loop counter runs while the byte before is clocked out
+		SPI_ControllerPut(hi);
+		SPI_ControllerPut(lo);
+	}
+}
+
+/**************************************************************************//**
+* @fn			void LCD_brightness(uint8_t intensity)
+* @brief		Changes the intensity of the LCD screen (max = 255)
+* @note
+*****************************************************************************/
+void LCD_brightness(uint8_t intensity)
+{
+	OCR0A = intensity;	//Set PWM value
+}
+
+/**************************************************************************//**
+* @fn			void LCD_rotate(uint8_t r)
+* @brief		Rotate display to another orientation
+* @note
+*****************************************************************************/
+void LCD_rotate(uint8_t r)
+{
+	uint8_t madctl = 0;
+	uint8_t rotation = r % 4; // can't be higher than 3
+
+	switch (rotation) {
+		case 0:
+			madctl = MADCTL_MX | MADCTL_MY | MADCTL_RGB;
+			break;
+		case 1:
+			madctl = MADCTL_MY | MADCTL_MV | MADCTL_RGB;
+			break;
+		case 2:
+			madctl = MADCTL_RGB;
+			break;
+		case 3:
+			madctl = MADCTL_MX | MADCTL_MV | MADCTL_RGB;
+			break;
+		default:
+			madctl = MADCTL_MX | MADCTL_MY | MADCTL_RGB;
+			break;
+	}
+	
+	uint8_t ST7735_cmds[]  =
+	{
+		ST7735_MADCTL, 1, madctl, 0
+	};
+	
+	sendCommands(ST7735_cmds, 1);
+}
+
+#if LCD_PROFILE
+/**************************************************************************//**
+* @fn			ISR(TIMER1_OVF_vect)
+* @brief		Extend the free-running Timer1 to a 32-bit cycle counter
+* @note
+*****************************************************************************/
+ISR(TIMER1_OVF_vect)
+{
+	profileOverflows++;
+}
+
+/**************************************************************************//**
+* @fn			void LCD_profileInit(void)
+* @brief		Clear the counters and start Timer1 free-running at clk/1
+* @note			Cycles include interrupts that preempt the drawing code
+*****************************************************************************/
+void LCD_profileInit(void)
+{
+	TCCR1A = 0;		//Normal mode, counts 0 to 0xFFFF
+	TCCR1B = (1<<CS10);	//clk/1
+	TCNT1 = 0;
+	TIFR1 = (1<<TOV1);
+	TIMSK1 |= (1<<TOIE1);
+
+	profileBytes = 0;
+	profileWindows = 0;
+	profileOverflows = 0;
+}
+
+/**************************************************************************//**
+* @fn			void LCD_profileSnapshot(LCD_counters_t *now)
+* @brief		Read the cycle counter and the SPI traffic totals
+* @note			An overflow that is pending but not yet serviced is counted
+*****************************************************************************/
+void LCD_profileSnapshot(LCD_counters_t *now)
+{
+	uint8_t sreg = SREG;
+	uint16_t ticks, high;
+
+	cli();
+	ticks = TCNT1;
+	high = profileOverflows;
+	if ((TIFR1 & (1<<TOV1)) && ticks < 0x8000)
+	{
+		high++;		//Wrapped after cli(), ISR still pending
+	}
+	SREG = sreg;
+
+	now->cycles = ((uint32_t)high << 16) | ticks;
+	now->bytes = profileBytes;
+	now->windows = profileWindows;
+}
+#endif
@@ -13,6 +13,7 @@
 *****************************************************************************/
 
 #include <avr/io.h>
+#include "drivers_config.h"
 
 #ifndef ST7735_H_
 #define ST7735_H_
@@ -34,6 +35,9 @@
 #define LCD_HEIGHT 128
 #define LCD_SIZE  LCD_WIDTH * LCD_HEIGHT
 
+// Set LCD_PROFILE=1 in project_config.h to count SPI traffic and time the drawing
+// code. Timer1 then runs free at clk/1 and is no longer available to the application.
+
 //! \name Return error codes
 //! @{
 #define ADAFRUIT358_SPI_NO_ERR                 0 //! No error
@@ -97,7 +101,7 @@
 #define MADCTL_BGR 0x08
 #define MADCTL_MH  0x04
 
-//Macro Functions
+//Macro Functions
 #define set(reg,bit) (reg) |= (1<<(bit))
 #define clear(reg,bit) (reg) &= ~(1<<(bit))
 #define toggle(reg,bit) (reg) ^= (1<<(bit))
@@ -107,7 +111,11 @@
 void Delay_ms(unsigned int n);
 void lcd_init(void);
 void sendCommands (const uint8_t *cmds, uint8_t length);
+void sendCommands_P (const uint8_t *cmds, uint8_t length);
 void LCD_setAddr(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void LCD_openWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void LCD_closeWindow(void);
+void LCD_pushColor(uint16_t color, uint16_t count);
 void SPI_ControllerTx(uint8_t data);
 void SPI_ControllerTx_stream(uint8_t stream);
 void SPI_ControllerTx_16bit(uint16_t data);
@@ -115,4 +123,16 @@ void SPI_ControllerTx_16bit_stream(uint16_t data);
 void LCD_brightness(uint8_t intensity);
 void LCD_rotate(uint8_t r);
 
-#endif /* ST7735_H_ */
\ No newline at end of file
+#if LCD_PROFILE
+// Running totals since LCD_profileInit(), subtract two snapshots for a delta
+typedef struct {
+	uint32_t cycles;	// CPU cycles, wraps after ~268 s at 16 MHz
+	uint32_t bytes;		// bytes clocked out on SPI, commands included
+	uint32_t windows;	// address windows set up (CASET/RASET/RAMWR)
+} LCD_counters_t;
+
+void LCD_profileInit(void);
+void LCD_profileSnapshot(LCD_counters_t *now);
+#endif
+
+#endif /* ST7735_H_ */
\ No newline at end of file
@@ -0,0 +1,111 @@
+/**
+ * @file drivers_config.h
+ * @brief Compile-time configuration of the shared drivers in common/
+ * @details Each project provides a project_config.h next to its main.c and
+ *          adds both its own directory and ../common to the include path.
+ *          Anything project_config.h defines overrides the defaults below,
+ *          so every driver file sees the same settings.
+ */
+
+#ifndef DRIVERS_CONFIG_H
+#define DRIVERS_CONFIG_H
+
+#include "project_config.h"
+
+/***************************************/
+/* CPU */
+/***************************************/
+
+// Used by util/delay.h, the I2C bit rate, the UART baud rate and the timer
+// periods of the projects
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+/***************************************/
+/* UART */
+/***************************************/
+
+// Baud rate, tested with 9600
+#ifndef UART_BAUD_RATE
+#define UART_BAUD_RATE 9600
+#endif
+
+// Transmit ring buffer size in bytes, a power of two from 2 to 256
+#ifndef UART_TX_BUFFER_SIZE
+#define UART_TX_BUFFER_SIZE 128
+#endif
+
+/**
+ * What uart_send() does when the transmit buffer is full
+ *      UART_TX_DROP    :   discard the character and count it, never waits
+ *      UART_TX_BLOCK   :   wait until the interrupt has made room
+ */
+#define UART_TX_DROP 0
+#define UART_TX_BLOCK 1
+#ifndef UART_TX_OVERFLOW
+#define UART_TX_OVERFLOW UART_TX_DROP
+#endif
+
+// 1 builds uart_scanf() and determine_line_ending(), see uart.h
+#ifndef UART_ENABLE_SCANF
+#define UART_ENABLE_SCANF 0
+#endif
+
+/***************************************/
+/* I2C */
+/***************************************/
+
+// Number of asynchronous transactions that can wait for the bus
+#ifndef I2C_QUEUE_SIZE
+#define I2C_QUEUE_SIZE 4
+#endif
+
+/***************************************/
+/* MAX30102 */
+/***************************************/
+
+// ADC resolution the FIFO unpacking is built for, 15 to 18 bits for pulse
+// widths of 69 to 411 us. max30102_configure() then only accepts that pulse
+// width. 0 follows the configured pulse width at run time.
+#ifndef MAX30102_FIXED_RESOLUTION
+#define MAX30102_FIXED_RESOLUTION 18
+#endif
+
+// 1 stores the ring as 16-bit deltas, 4 bytes per sample instead of 8. A
+// step of more than 32767 counts inside one FIFO burst is spread over the
+// following samples and counted in max30102_stream_stats_t.clipped.
+#ifndef MAX30102_RING_DELTA
+#define MAX30102_RING_DELTA 0
+#endif
+
+// Sample ring between the FIFO drain and the DSP, a power of two up to 128.
+// The default takes 512 bytes of SRAM either way.
+#ifndef MAX30102_RING_SIZE
+#if MAX30102_RING_DELTA
+#define MAX30102_RING_SIZE 128
+#else
+#define MAX30102_RING_SIZE 64
+#endif
+#endif
+
+/***************************************/
+/* LCD */
+/***************************************/
+
+// 1 counts SPI traffic and times the drawing code, Timer1 is then taken
+#ifndef LCD_PROFILE
+#define LCD_PROFILE 0
+#endif
+
+/***************************************/
+/* IMU */
+/***************************************/
+
+// The LSM6DSO driver in imu.h is declarations only, 0 hides them so a call
+// fails at compile time instead of at link time
+#ifndef IMU_ENABLE
+#define IMU_ENABLE 0
+#endif
+
+#endif /* DRIVERS_CONFIG_H */
@@ -3,11 +3,13 @@
  * @brief I2C communication library implementation for ATMEGA328PB using XC8 compiler
  * @details Used for MAXREFDES117# sensor communication
  */
-#define F_CPU 16000000UL
 #include "i2c.h"
 #include <xc.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
 
 // TWI status codes for XC8 compiler
 #define TW_START        0x08
@@ -20,6 +22,7 @@
 #define TW_MR_SLA_NACK  0x48
 #define TW_MR_DATA_ACK  0x50
 #define TW_MR_DATA_NACK 0x58
+#define TW_MT_ARB_LOST  0x38
 
 // XC8 bit definitions for TWI
 #define TWINT  7
@@ -29,11 +32,28 @@
 #define TWEN   2
 #define TWPS0  0
 #define TWPS1  1
+#define TWIE   0
 
 // Private function prototypes
 static bool i2c_wait(uint16_t timeout_ms);
 static void delay_us(uint16_t us);
 static void delay_ms(uint16_t ms);
+static void i2c_async_start_next(void);
+static void i2c_async_finish(bool success);
+
+// Asynchronous engine state, owned by the TWI ISR while a transaction runs
+typedef enum {
+    I2C_PHASE_REG = 0,      // Sending SLA+W and the register address
+    I2C_PHASE_WRITE,        // Sending data bytes
+    I2C_PHASE_READ          // Repeated start done, receiving data bytes
+} i2c_phase_t;
+
+static i2c_transaction_t *volatile i2c_queue[I2C_QUEUE_SIZE];
+static volatile uint8_t i2c_queue_head = 0;
+static volatile uint8_t i2c_queue_count = 0;
+static i2c_transaction_t *volatile i2c_current = NULL;
+static i2c_phase_t i2c_phase;
+static uint8_t i2c_index;
 
 // Simple delay functions
 static void delay_us(uint16_t us) {
@@ -120,6 +140,9 @@ static bool i2c_wait(uint16_t timeout_ms) {
  * @return true if successful, false otherwise
  */
 bool i2c_start(void) {
+    // Blocking transfers must not interleave with the asynchronous engine
+    while (i2c_async_busy());
+    
     // Send START condition
     TWCR0 = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN);
     
@@ -435,4 +458,171 @@ bool i2c_is_device_ready(uint8_t address) {
     
     i2c_stop();
     return result;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Queue an asynchronous register read or write
+ * @param txn transaction descriptor, owned by the engine until completion
+ * @return true if queued, false if the queue is full or txn is already pending
+ */
+bool i2c_submit(i2c_transaction_t *txn) {
+    bool queued = false;
+    
+    if (txn == NULL || txn->status == I2C_TXN_PENDING) {
+        return false;
+    }
+    
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if (i2c_queue_count < I2C_QUEUE_SIZE) {
+            uint8_t tail = (i2c_queue_head + i2c_queue_count) % I2C_QUEUE_SIZE;
+            txn->status = I2C_TXN_PENDING;
+            i2c_queue[tail] = txn;
+            i2c_queue_count++;
+            queued = true;
+            
+            // Kick the engine if the bus is free
+            if (i2c_current == NULL) {
+                i2c_async_start_next();
+            }
+        }
+    }
+    
+    return queued;
+}
+
+/**
+ * @brief Check if asynchronous transactions are queued or on the bus
+ * @return true if the engine is busy, false if idle
+ */
+bool i2c_async_busy(void) {
+    return (i2c_current != NULL) || (i2c_queue_count != 0);
+}
+
+/**
+ * @brief Take the next queued transaction and send its START condition
+ * @note Called with interrupts disabled or from the TWI ISR
+ */
+static void i2c_async_start_next(void) {
+    if (i2c_queue_count == 0) {
+        i2c_current = NULL;
+        return;
+    }
+    
+    i2c_current = i2c_queue[i2c_queue_head];
+    i2c_queue_head = (i2c_queue_head + 1) % I2C_QUEUE_SIZE;
+    i2c_queue_count--;
+    
+    i2c_phase = I2C_PHASE_REG;
+    i2c_index = 0;
+    
+    // Send START, the ISR takes over from here
+    TWCR0 = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE);
+}
+
+/**
+ * @brief Send STOP, report the result and move on to the next transaction
+ * @param success true if the transaction completed
+ * @note Called from the TWI ISR
+ */
+static void i2c_async_finish(bool success) {
+    i2c_transaction_t *txn = i2c_current;
+    
+    // Send STOP without TWIE, the bus goes quiet once it is executed
+    TWCR0 = (1 << TWINT) | (1 << TWSTO) | (1 << TWEN);
+    while (TWCR0 & (1 << TWSTO));
+    
+    i2c_current = NULL;
+    txn->status = success ? I2C_TXN_DONE : I2C_TXN_ERROR;
+    
+    // The callback may submit the next step of a chained transfer
+    if (txn->callback != NULL) {
+        txn->callback(success, txn->context);
+    }
+    
+    if (i2c_current == NULL) {
+        i2c_async_start_next();
+    }
+}
+
+/**
+ * @brief TWI interrupt: advance the current transaction by one bus event
+ */
+ISR(TWI0_vect) {
+    i2c_transaction_t *txn = i2c_current;
+    uint8_t status = TWSR0 & 0xF8;
+    
+    if (txn == NULL) {
+        // Nothing to do, release the bus
+        TWCR0 = (1 << TWINT) | (1 << TWSTO) | (1 << TWEN);
+        return;
+    }
+    
+    switch (status) {
+        case TW_START:
+            // SLA+W to select the register
+            TWDR0 = txn->dev_addr << 1;
+            TWCR0 = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+            break;
+            
+        case TW_REP_START:
+            // SLA+R to read the selected register
+            TWDR0 = (txn->dev_addr << 1) | 1;
+            TWCR0 = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+            break;
+            
+        case TW_MT_SLA_ACK:
+            TWDR0 = txn->reg_addr;
+            TWCR0 = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+            break;
+            
+        case TW_MT_DATA_ACK:
+            if (i2c_phase == I2C_PHASE_REG) {
+                if (txn->read) {
+                    // Register selected, turn the bus around
+                    i2c_phase = I2C_PHASE_READ;
+                    TWCR0 = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE);
+                    break;
+                }
+                i2c_phase = I2C_PHASE_WRITE;
+            }
+            
+            if (i2c_index < txn->len) {
+                TWDR0 = txn->data[i2c_index++];
+                TWCR0 = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+            } else {
+                i2c_async_finish(true);
+            }
+            break;
+            
+        case TW_MR_SLA_ACK:
+            if (txn->len == 0) {
+                i2c_async_finish(true);
+            } else if (txn->len == 1) {
+                // Only byte, NACK it
+                TWCR0 = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+            } else {
+                TWCR0 = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWEA);
+            }
+            break;
+            
+        case TW_MR_DATA_ACK:
+            txn->data[i2c_index++] = TWDR0;
+            if (i2c_index >= txn->len - 1) {
+                // NACK the last byte
+                TWCR0 = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+            } else {
+                TWCR0 = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWEA);
+            }
+            break;
+            
+        case TW_MR_DATA_NACK:
+            txn->data[i2c_index++] = TWDR0;
+            i2c_async_finish(true);
+            break;
+            
+        default:
+            // SLA or data NACK, arbitration lost or bus error
+            i2c_async_finish(false);
+            break;
+    }
+}
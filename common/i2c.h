@@ -10,6 +10,35 @@
 #include <xc.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "drivers_config.h"
+
+// Asynchronous transaction status
+typedef enum {
+    I2C_TXN_IDLE = 0,       // Not submitted yet
+    I2C_TXN_PENDING,        // Queued or on the bus
+    I2C_TXN_DONE,           // Completed successfully
+    I2C_TXN_ERROR           // NACK, arbitration loss or bus error
+} i2c_txn_status_t;
+
+/**
+ * @brief Completion callback for asynchronous transactions
+ * @param success true if the transaction completed, false on error
+ * @param context user pointer from the transaction descriptor
+ * @note Runs in TWI interrupt context, keep it short
+ */
+typedef void (*i2c_callback_t)(bool success, void *context);
+
+// Asynchronous register transaction descriptor, must stay valid until done
+typedef struct {
+    uint8_t dev_addr;           // 7-bit device address
+    uint8_t reg_addr;           // First register to access
+    uint8_t *data;              // Buffer to read into or write from
+    uint8_t len;                // Number of data bytes
+    bool read;                  // true: register read, false: register write
+    i2c_callback_t callback;    // Called on completion, may be NULL
+    void *context;              // Passed to callback
+    volatile i2c_txn_status_t status;
+} i2c_transaction_t;
 
 /**
  * @brief Initialize I2C communication
@@ -118,4 +147,19 @@ bool i2c_is_device_ready(uint8_t address);
  */
 bool i2c_wait_for_complete(uint16_t timeout_ms);
 
+/**
+ * @brief Queue an asynchronous register read or write
+ * @param txn transaction descriptor, owned by the engine until completion
+ * @return true if queued, false if the queue is full or txn is already pending
+ * @note The write-register / repeated-start / read sequence runs from the TWI
+ *       ISR. Safe to call from a completion callback to chain transactions.
+ */
+bool i2c_submit(i2c_transaction_t *txn);
+
+/**
+ * @brief Check if asynchronous transactions are queued or on the bus
+ * @return true if the engine is busy, false if idle
+ */
+bool i2c_async_busy(void);
+
 #endif /* I2C_H */
\ No newline at end of file
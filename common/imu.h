@@ -9,10 +9,13 @@
  */
 
 #include <stdint.h>
+#include "drivers_config.h"
 
 #ifndef IMU_H
 #define	IMU_H
 
+#if IMU_ENABLE
+
 void IMU_init(uint8_t addr);
 
 void IMU_getAll();
@@ -33,5 +36,7 @@ void IMU_getTemp();
 
 int IMU_checkNewData();
 
+#endif /* IMU_ENABLE */
+
 #endif	/* LSM6DS0_H */
 
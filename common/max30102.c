@@ -0,0 +1,1638 @@
+/**
+ * @file max30102.c
+ * @brief MAX30102 heart-rate and SpO2 sensor driver implementation for ATMEGA328PB
+ * @details Driver for MAXREFDES117# Heart-Rate and Pulse-Oximetry Monitor
+ */
+
+#include "max30102.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+
+// Default configuration values
+#define DEFAULT_SAMPLE_RATE MAX30102_SAMPLE_RATE_100_HZ
+#if MAX30102_FIXED_RESOLUTION
+#if (MAX30102_FIXED_RESOLUTION < 15) || (MAX30102_FIXED_RESOLUTION > 18)
+#error "MAX30102_FIXED_RESOLUTION must be 15 to 18 bits, or 0"
+#endif
+#define DEFAULT_PULSE_WIDTH ((max30102_pulse_width_t)(MAX30102_FIXED_RESOLUTION - 15))
+#else
+#define DEFAULT_PULSE_WIDTH MAX30102_PULSE_WIDTH_411_US
+#endif
+#define DEFAULT_ADC_RANGE MAX30102_ADC_RANGE_16384_NA
+#define DEFAULT_LED_RED_AMPLITUDE 0x1F  // ~6.4mA
+#define DEFAULT_LED_IR_AMPLITUDE 0x1F   // ~6.4mA
+#define DEFAULT_SAMPLE_AVG 0            // No averaging, 100 samples/s
+#define DEFAULT_FIFO_ROLLOVER true
+#define DEFAULT_FIFO_ALMOST_FULL 15
+
+// Number of samples to discard after configuration change
+#define DISCARD_SAMPLES 5
+
+// FIFO data is left-justified in 18 bits, shorter pulse widths leave the
+// low bits undefined. A fixed resolution makes the shift a constant.
+#if MAX30102_FIXED_RESOLUTION
+#define SAMPLE_SHIFT (18 - MAX30102_FIXED_RESOLUTION)
+#else
+#define SAMPLE_SHIFT (MAX30102_PULSE_WIDTH_411_US - current_pulse_width)
+#endif
+
+// Streaming heart-rate estimator tuning, in samples at 100 samples/s
+#define HR_SAMPLE_RATE        100     // Samples per second out of the FIFO
+#define HR_DC_SHIFT           6       // DC tracker time constant, 64 samples
+#define HR_LP_SHIFT           3       // Low-pass smoothing, ~2 Hz corner
+#define HR_SLOPE_SPAN         4       // Slope taken over 40 ms, power of two
+#define HR_THRESHOLD_DECAY    8       // Threshold decay per sample, 1/256
+#define HR_FINGER_THRESHOLD   5000    // Minimum IR level with a finger on
+#define HR_MIN_PEAK           64      // Threshold floor in ADC counts
+#define HR_SETTLE_SAMPLES     100     // DC tracker settling after finger on,
+                                      // its steepest upstroke seeds the threshold
+#define HR_REFRACTORY         30      // 300 ms, caps the rate at 200 BPM
+#define HR_MAX_INTERVAL       150     // 1.5 s, below 40 BPM the rhythm is lost
+#define HR_IBI_COUNT          4       // Inter-beat intervals averaged
+#define HR_MIN_INTERVALS      3       // Intervals needed for a valid estimate
+#define HR_RHYTHM_INTERVALS   2       // Intervals before off-rhythm ones are rejected
+
+// Automatic gain control. DC levels are relative to the ADC full scale of the
+// current pulse width, the LED current is 0.2 mA per amplitude step.
+#define AGC_BLOCK_SHIFT       5       // DC averaged over 32 samples
+#define AGC_PRESENCE          2500    // IR DC below this means nothing to regulate
+#define AGC_AMP_MIN           0x02    // 0.4 mA
+#define AGC_AMP_MAX           0xFF    // 51 mA
+#define AGC_AMP_EFFICIENT     0x40    // Above 12.8 mA a more sensitive range is used
+
+// Presence detection while idle
+#define PRESENCE_SAMPLE_RATE  MAX30102_SAMPLE_RATE_50_HZ
+#define PRESENCE_SAMPLE_AVG   3       // 8 averaged, 6.25 samples/s
+#define PRESENCE_ADC_RANGE    MAX30102_ADC_RANGE_16384_NA
+#define PRESENCE_IR_AMPLITUDE 0x0A    // ~2mA, red LED off
+#define PRESENCE_THRESHOLD    1500    // HR_FINGER_THRESHOLD scaled to the dim LED
+
+// Result smoother over the last HISTORY_SIZE beats, power of two
+#define HISTORY_SIZE          8
+#define HISTORY_STABLE_COUNT  3       // Beats needed before the result is stable
+#define HISTORY_STABLE_VAR    16      // Variance limit for stable, 4 BPM spread
+#define HISTORY_MAX_VAR       100     // Variance at which confidence hits zero
+
+// SpO2 ratio-of-ratios in fixed point
+#define SPO2_PI_SHIFT         16      // Perfusion index AC/DC in Q16
+#define SPO2_R_SHIFT          8       // R in Q8
+#define SPO2_LUT_SHIFT        3       // LUT step of 1/32 in R
+#define SPO2_LUT_SIZE         64      // Covers R = 0 .. 2
+#define SPO2_AC_LIMIT         0x8000  // Larger AC swings are motion, not pulse
+
+// Private function prototypes
+static bool max30102_write_register(uint8_t reg_addr, uint8_t data);
+static bool max30102_read_register(uint8_t reg_addr, uint8_t *data);
+static bool max30102_read_registers(uint8_t reg_addr, uint8_t *data, uint8_t len);
+static bool max30102_clear_fifo(void);
+static inline uint32_t max30102_unpack_channel(const uint8_t *raw);
+static void max30102_unpack_samples(const uint8_t *raw, max30102_fifo_sample_t *samples, uint8_t count);
+static void max30102_fifo_async_step(bool success, void *context);
+static void max30102_stream_push(uint8_t *raw, uint8_t count);
+#if MAX30102_RING_DELTA
+static int16_t max30102_delta_encode(uint32_t value, volatile uint32_t *ref);
+#endif
+static bool max30102_spo2_from_ratio(uint32_t red_ac, uint32_t red_dc,
+                                     uint32_t ir_ac, uint32_t ir_dc, int32_t *spo2);
+static void max30102_history_reset(void);
+static void max30102_history_push_hr(uint8_t heart_rate);
+static void max30102_history_push_spo2(uint8_t spo2);
+static void max30102_history_get(max30102_result_t *result);
+static uint8_t max30102_agc_filter(max30102_fifo_sample_t *samples, uint8_t count);
+static bool max30102_agc_adjust(uint32_t red_dc, uint32_t ir_dc);
+
+// SpO2 = 110 - 25 * R, clamped to 70..100, sampled at the centre of each
+// 1/32 step of R so the lookup truncates like the float formula did
+static const uint8_t spo2_lut[SPO2_LUT_SIZE] PROGMEM = {
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 99, 98, 97,
+    97, 96, 95, 94, 93, 93, 92, 91, 90, 90, 89, 88, 87, 86, 86, 85,
+    84, 83, 83, 82, 81, 80, 79, 79, 78, 77, 76, 76, 75, 74, 73, 72,
+    72, 71, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70
+};
+
+// Samples per blocking FIFO_DATA read, bounds the stack buffer
+#define FIFO_READ_CHUNK 8
+
+// Global variables
+static max30102_sample_rate_t current_sample_rate = DEFAULT_SAMPLE_RATE;
+static max30102_pulse_width_t current_pulse_width = DEFAULT_PULSE_WIDTH;
+static max30102_adc_range_t current_adc_range = DEFAULT_ADC_RANGE;
+static max30102_led_amplitude_t current_led = {
+    .red = DEFAULT_LED_RED_AMPLITUDE,
+    .ir = DEFAULT_LED_IR_AMPLITUDE
+};
+
+// Automatic gain control state
+typedef struct {
+    uint32_t red_sum;               // DC accumulators over one block
+    uint32_t ir_sum;
+    uint8_t count;                  // Samples in the current block
+    uint8_t discard;                // Transient samples left to drop
+    uint16_t changes;               // Configuration changes made
+    bool enabled;
+    bool rebase;                    // DC stepped, restart the HR estimator
+} agc_state_t;
+
+static agc_state_t agc = { .enabled = true };
+
+// Acquisition runs from max30102_init() on
+static max30102_power_mode_t power_mode = MAX30102_POWER_ACTIVE;
+
+// Sliding-window smoother, running sums give O(1) updates
+static uint8_t heart_rate_history[HISTORY_SIZE] = {0};
+static uint8_t spo2_history[HISTORY_SIZE] = {0};
+static uint8_t history_index = 0;
+static uint8_t history_count = 0;
+static uint16_t hr_sum = 0;
+static uint32_t hr_sum_sq = 0;
+static uint8_t spo2_index = 0;
+static uint8_t spo2_count = 0;
+static uint16_t spo2_sum = 0;
+
+// Streaming heart-rate estimator state
+typedef struct {
+    int32_t dc_acc;                 // DC level scaled by 2^HR_DC_SHIFT
+    int32_t lp;                     // Low-passed AC signal, pulse peaks positive
+    int32_t lp_hist[HR_SLOPE_SPAN]; // Recent low-passed values for the slope
+    uint8_t lp_index;
+    int32_t prev;                   // Previous two slope values
+    int32_t prev2;
+    int32_t peak_level;             // Running average of peak heights
+    int32_t threshold;              // Adaptive detection threshold
+    uint16_t since_beat;            // Samples since the last beat
+    uint16_t settle;                // Samples left before detection starts
+    uint16_t ibi[HR_IBI_COUNT];     // Recent inter-beat intervals in samples
+    uint8_t ibi_index;
+    uint8_t ibi_count;
+    uint8_t rejected;               // Consecutive intervals off the rhythm
+    uint16_t beat_interval;         // Interval taken on this beat, 0 if none
+    bool have_beat;                 // A previous beat anchors the next interval
+    bool finger;
+} hr_state_t;
+
+static hr_state_t hr;
+
+// Asynchronous FIFO drain state
+typedef enum {
+    FIFO_ASYNC_IDLE = 0,
+    FIFO_ASYNC_STATUS,      // Reading INT_STATUS_1/2
+    FIFO_ASYNC_PTRS,        // Reading FIFO_WR_PTR, OVF_CNT, RD_PTR
+    FIFO_ASYNC_DATA,        // Bursting FIFO_DATA
+    FIFO_ASYNC_READY        // Finished, waiting for max30102_fifo_read_complete()
+} fifo_async_state_t;
+
+static i2c_transaction_t fifo_txn;
+static uint8_t fifo_regs[3];
+static uint8_t fifo_raw[MAX30102_FIFO_DEPTH * MAX30102_BYTES_PER_SAMPLE];
+static volatile fifo_async_state_t fifo_async_state = FIFO_ASYNC_IDLE;
+static volatile uint8_t fifo_async_count = 0;
+
+// Streaming ring buffer, free-running indices wrap at 256
+#if (MAX30102_RING_SIZE > 128) || (MAX30102_RING_SIZE & (MAX30102_RING_SIZE - 1))
+#error "MAX30102_RING_SIZE must be a power of two up to 128"
+#endif
+
+#if MAX30102_RING_DELTA
+// Change from the previous sample, half the size of max30102_fifo_sample_t
+typedef struct {
+    int16_t red;
+    int16_t ir;
+} ring_entry_t;
+
+static volatile max30102_fifo_sample_t ring_push_ref;   // Last sample stored, as it decodes
+static volatile max30102_fifo_sample_t ring_pop_ref;    // Last sample returned
+#else
+typedef max30102_fifo_sample_t ring_entry_t;
+#endif
+
+static ring_entry_t stream_ring[MAX30102_RING_SIZE];
+// The TWI interrupt advances the head, main context the tail
+static volatile uint8_t stream_head = 0;
+static volatile uint8_t stream_tail = 0;
+static max30102_stream_stats_t stream_stats;
+
+/**
+ * @brief Initialize the MAX30102 sensor
+ * @return true if successful, false otherwise
+ */
+bool max30102_init(void) {
+    uint8_t part_id;
+    
+    // Reset the sensor
+    if (!max30102_reset()) {
+        return false;
+    }
+    
+    // Verify part ID
+    if (!max30102_read_part_id(&part_id)) {
+        return false;
+    }
+    
+    if (part_id != 0x15) {  // MAX30102 part ID
+        return false;
+    }
+    
+    // Default configuration
+    max30102_led_amplitude_t led_amplitude = {
+        .red = DEFAULT_LED_RED_AMPLITUDE,
+        .ir = DEFAULT_LED_IR_AMPLITUDE
+    };
+    
+    if (!max30102_configure(DEFAULT_SAMPLE_RATE, DEFAULT_PULSE_WIDTH, 
+                           DEFAULT_ADC_RANGE, led_amplitude)) {
+        return false;
+    }
+    
+    // Configure FIFO
+    if (!max30102_configure_fifo(DEFAULT_SAMPLE_AVG, DEFAULT_FIFO_ROLLOVER, 
+                                DEFAULT_FIFO_ALMOST_FULL)) {
+        return false;
+    }
+    
+    // Set SPO2+HR mode
+    if (!max30102_set_mode(MAX30102_MODE_SPO2_HR)) {
+        return false;
+    }
+    
+    // Enable FIFO almost full interrupt
+    if (!max30102_set_interrupt_enables(MAX30102_INT_A_FULL, 0x00)) {
+        return false;
+    }
+    
+    // Clear FIFO
+    if (!max30102_clear_fifo()) {
+        return false;
+    }
+    
+    power_mode = MAX30102_POWER_ACTIVE;
+    return true;
+}
+
+/**
+ * @brief Reset the MAX30102 sensor
+ * @return true if successful, false otherwise
+ */
+bool max30102_reset(void) {
+    // Set reset bit in MODE_CONFIG register
+    if (!max30102_write_register(MAX30102_MODE_CONFIG, MAX30102_MODE_RESET)) {
+        return false;
+    }
+    
+    // Wait for reset to complete (reset bit clears automatically)
+    uint8_t mode_config;
+    uint8_t retry = 10;
+    
+    do {
+        if (!max30102_read_register(MAX30102_MODE_CONFIG, &mode_config)) {
+            return false;
+        }
+        
+        if ((mode_config & MAX30102_MODE_RESET) == 0) {
+            break;
+        }
+        
+        // Simple delay
+        for (uint16_t i = 0; i < 10000; i++) {
+            asm("nop");
+        }
+        
+        retry--;
+    } while (retry > 0);
+    
+    if (retry == 0) {
+        return false;  // Reset timeout
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Configure the MAX30102 sensor
+ * @param sample_rate Sample rate setting
+ * @param pulse_width Pulse width setting
+ * @param adc_range ADC range setting
+ * @param led_amplitude LED current amplitudes
+ * @return true if successful, false otherwise
+ */
+bool max30102_configure(max30102_sample_rate_t sample_rate, 
+                      max30102_pulse_width_t pulse_width,
+                      max30102_adc_range_t adc_range,
+                      max30102_led_amplitude_t led_amplitude) {
+                      
+#if MAX30102_FIXED_RESOLUTION
+    // The sample unpacking is built for one resolution only
+    if (pulse_width != DEFAULT_PULSE_WIDTH) {
+        return false;
+    }
+#endif
+    
+    // Store the configuration for sample extraction and the AGC
+    current_sample_rate = sample_rate;
+    current_pulse_width = pulse_width;
+    current_adc_range = adc_range;
+    current_led = led_amplitude;
+    
+    // Configure SPO2 settings (sample rate, pulse width, ADC range)
+    uint8_t spo2_config = (sample_rate << 2) | (pulse_width << 0);
+    spo2_config |= MAX30102_SPO2_HI_RES_EN; // Enable high resolution mode
+    spo2_config |= (adc_range << 4);
+    
+    if (!max30102_write_register(MAX30102_SPO2_CONFIG, spo2_config)) {
+        return false;
+    }
+    
+    // Set LED pulse amplitudes
+    if (!max30102_write_register(MAX30102_LED1_PA, led_amplitude.red)) {
+        return false;
+    }
+    
+    if (!max30102_write_register(MAX30102_LED2_PA, led_amplitude.ir)) {
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Set the mode of operation
+ * @param mode Mode setting (MAX30102_MODE_HR_ONLY or MAX30102_MODE_SPO2_HR)
+ * @return true if successful, false otherwise
+ */
+bool max30102_set_mode(uint8_t mode) {
+    // Read current mode configuration
+    uint8_t mode_config;
+    if (!max30102_read_register(MAX30102_MODE_CONFIG, &mode_config)) {
+        return false;
+    }
+    
+    // Clear mode bits (bits 2:0) and set new mode
+    mode_config &= ~0x07;  // Clear bits 2:0
+    mode_config |= mode;   // Set new mode
+    
+    // Write updated mode configuration
+    if (!max30102_write_register(MAX30102_MODE_CONFIG, mode_config)) {
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Set the interrupt enables
+ * @param int_1 Interrupt enable 1 register value
+ * @param int_2 Interrupt enable 2 register value
+ * @return true if successful, false otherwise
+ */
+bool max30102_set_interrupt_enables(uint8_t int_1, uint8_t int_2) {
+    if (!max30102_write_register(MAX30102_INT_ENABLE_1, int_1)) {
+        return false;
+    }
+    
+    if (!max30102_write_register(MAX30102_INT_ENABLE_2, int_2)) {
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Read and clear interrupt status
+ * @param int_status_1 Pointer to store interrupt status 1
+ * @param int_status_2 Pointer to store interrupt status 2
+ * @return true if successful, false otherwise
+ */
+bool max30102_read_interrupt_status(uint8_t *int_status_1, uint8_t *int_status_2) {
+    if (!max30102_read_register(MAX30102_INT_STATUS_1, int_status_1)) {
+        return false;
+    }
+    
+    if (!max30102_read_register(MAX30102_INT_STATUS_2, int_status_2)) {
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Configure the FIFO settings
+ * @param sample_avg Sample averaging (0=1, 1=2, 2=4, 3=8, 4=16, 5=32)
+ * @param fifo_rollover_en FIFO rollover enable
+ * @param fifo_almost_full_samples FIFO almost full value (0-15)
+ * @return true if successful, false otherwise
+ */
+bool max30102_configure_fifo(uint8_t sample_avg, bool fifo_rollover_en, uint8_t fifo_almost_full_samples) {
+    uint8_t fifo_config = 0;
+    
+    // Set sample averaging bits (bits 7:5)
+    fifo_config |= (sample_avg & 0x07) << 5;
+    
+    // Set FIFO rollover bit (bit 4)
+    if (fifo_rollover_en) {
+        fifo_config |= (1 << 4);
+    }
+    
+    // Set FIFO almost full value (bits 3:0)
+    fifo_config |= (fifo_almost_full_samples & 0x0F);
+    
+    // Write FIFO configuration
+    if (!max30102_write_register(MAX30102_FIFO_CONFIG, fifo_config)) {
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Read FIFO pointers
+ * @param write_ptr Pointer to store write pointer value
+ * @param read_ptr Pointer to store read pointer value
+ * @param overflow_ctr Pointer to store overflow counter
+ * @return true if successful, false otherwise
+ */
+bool max30102_read_fifo_ptrs(uint8_t *write_ptr, uint8_t *read_ptr, uint8_t *overflow_ctr) {
+    if (!max30102_read_register(MAX30102_FIFO_WR_PTR, write_ptr)) {
+        return false;
+    }
+    
+    if (!max30102_read_register(MAX30102_FIFO_RD_PTR, read_ptr)) {
+        return false;
+    }
+    
+    if (!max30102_read_register(MAX30102_FIFO_OVF_CNT, overflow_ctr)) {
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Read samples from FIFO
+ * @param samples Pointer to array to store samples
+ * @param count Number of samples to read
+ * @return Number of samples read
+ */
+uint8_t max30102_read_fifo_samples(max30102_fifo_sample_t *samples, uint8_t count) {
+    // Fixed-size buffer, FIFO_DATA does not auto-increment so the burst can
+    // be split into several reads
+    uint8_t buffer[FIFO_READ_CHUNK * MAX30102_BYTES_PER_SAMPLE];
+    uint8_t done = 0;
+    
+    while (done < count) {
+        uint8_t chunk = count - done;
+        if (chunk > FIFO_READ_CHUNK) {
+            chunk = FIFO_READ_CHUNK;
+        }
+        
+        // Read data from FIFO
+        if (!max30102_read_registers(MAX30102_FIFO_DATA, buffer, chunk * MAX30102_BYTES_PER_SAMPLE)) {
+            break;
+        }
+        
+        max30102_unpack_samples(buffer, &samples[done], chunk);
+        done += chunk;
+    }
+    
+    return done;
+}
+
+/**
+ * @brief Start an interrupt-driven drain of the whole FIFO
+ * @return true if started, false if a drain is running or the I2C queue is full
+ */
+bool max30102_fifo_read_start(void) {
+    if (fifo_async_state != FIFO_ASYNC_IDLE) {
+        return false;
+    }
+    
+    fifo_async_count = 0;
+    
+    // Reading the status clears it and releases the INT pin
+    fifo_txn.dev_addr = MAX30102_I2C_ADDR;
+    fifo_txn.reg_addr = MAX30102_INT_STATUS_1;
+    fifo_txn.data = fifo_regs;
+    fifo_txn.len = 2;
+    fifo_txn.read = true;
+    fifo_txn.callback = max30102_fifo_async_step;
+    fifo_txn.context = NULL;
+    
+    fifo_async_state = FIFO_ASYNC_STATUS;
+    if (!i2c_submit(&fifo_txn)) {
+        fifo_async_state = FIFO_ASYNC_IDLE;
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Check if an asynchronous FIFO drain is running or waiting to be collected
+ * @return true if busy, false if a new drain can be started
+ */
+bool max30102_fifo_read_busy(void) {
+    return fifo_async_state != FIFO_ASYNC_IDLE;
+}
+
+/**
+ * @brief Move the samples of a finished asynchronous drain into the ring
+ * @return Number of samples added, 0 if nothing new
+ */
+uint8_t max30102_fifo_read_complete(void) {
+    uint8_t before;
+    
+    if (fifo_async_state != FIFO_ASYNC_READY) {
+        return 0;
+    }
+    
+    // Unpack in main context, the ISR only moved raw bytes
+    before = max30102_stream_available();
+    if (fifo_async_count > 0) {
+        stream_stats.bursts++;
+        stream_stats.overflows += fifo_regs[1];
+        max30102_stream_push(fifo_raw, fifo_async_count);
+    }
+    
+    fifo_async_state = FIFO_ASYNC_IDLE;
+    return max30102_stream_available() - before;
+}
+
+/**
+ * @brief Drain the whole FIFO into the ring using blocking I2C transfers
+ * @return Number of samples added to the ring
+ */
+uint8_t max30102_stream_drain(void) {
+    uint8_t write_ptr, read_ptr, overflow;
+    uint8_t before = max30102_stream_available();
+    uint8_t count;
+    
+    // The burst buffer belongs to the async drain while one is running
+    if (max30102_fifo_read_busy()) {
+        return 0;
+    }
+    
+    if (!max30102_read_fifo_ptrs(&write_ptr, &read_ptr, &overflow)) {
+        return 0;
+    }
+    
+    // Equal pointers with a nonzero overflow count mean the FIFO is full
+    count = (write_ptr - read_ptr) & (MAX30102_FIFO_DEPTH - 1);
+    if (count == 0 && overflow != 0) {
+        count = MAX30102_FIFO_DEPTH;
+    }
+    if (count == 0) {
+        return 0;
+    }
+    
+    stream_stats.bursts++;
+    stream_stats.overflows += overflow;
+    
+    while (count > 0) {
+        uint8_t chunk = count > FIFO_READ_CHUNK ? FIFO_READ_CHUNK : count;
+        
+        if (!max30102_read_registers(MAX30102_FIFO_DATA, fifo_raw, chunk * MAX30102_BYTES_PER_SAMPLE)) {
+            break;
+        }
+        max30102_stream_push(fifo_raw, chunk);
+        count -= chunk;
+    }
+    
+    return max30102_stream_available() - before;
+}
+
+/**
+ * @brief Number of samples waiting in the ring
+ * @return Sample count
+ */
+uint8_t max30102_stream_available(void) {
+    return (uint8_t)(stream_head - stream_tail);
+}
+
+/**
+ * @brief Take the oldest sample from the ring
+ * @param sample Pointer to store the sample
+ * @return true if a sample was returned, false if the ring is empty
+ */
+bool max30102_stream_pop(max30102_fifo_sample_t *sample) {
+    if (stream_head == stream_tail) {
+        return false;
+    }
+    
+#if MAX30102_RING_DELTA
+    const ring_entry_t *entry = &stream_ring[stream_tail & (MAX30102_RING_SIZE - 1)];
+    
+    // Sign extension makes the unsigned add wrap to the right value
+    ring_pop_ref.red += entry->red;
+    ring_pop_ref.ir += entry->ir;
+    *sample = ring_pop_ref;
+#else
+    *sample = stream_ring[stream_tail & (MAX30102_RING_SIZE - 1)];
+#endif
+    stream_tail++;
+    return true;
+}
+
+/**
+ * @brief Read the acquisition statistics
+ * @param stats Pointer to store the statistics
+ */
+void max30102_stream_get_stats(max30102_stream_stats_t *stats) {
+    *stats = stream_stats;
+}
+
+/**
+ * @brief Empty the ring and clear the statistics
+ */
+void max30102_stream_reset(void) {
+    stream_head = 0;
+    stream_tail = 0;
+    memset(&stream_stats, 0, sizeof(stream_stats));
+}
+
+/**
+ * @brief Unpack raw FIFO bytes into the ring
+ * @param raw Raw FIFO data, 6 bytes per sample
+ * @param count Number of samples
+ * @note Samples that do not fit are counted as dropped, older data is kept
+ */
+static void max30102_stream_push(uint8_t *raw, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        const uint8_t *sample_ptr = raw + (i * MAX30102_BYTES_PER_SAMPLE);
+        ring_entry_t *slot;
+        
+        if (max30102_stream_available() >= MAX30102_RING_SIZE) {
+            stream_stats.dropped += count - i;
+            return;
+        }
+        
+        slot = &stream_ring[stream_head & (MAX30102_RING_SIZE - 1)];
+#if MAX30102_RING_DELTA
+        uint32_t red = max30102_unpack_channel(sample_ptr);
+        uint32_t ir = max30102_unpack_channel(sample_ptr + 3);
+        
+        // Nothing left to decode against, start the deltas from this sample
+        if (stream_head == stream_tail) {
+            ring_push_ref.red = red;
+            ring_push_ref.ir = ir;
+            ring_pop_ref = ring_push_ref;
+        }
+        slot->red = max30102_delta_encode(red, &ring_push_ref.red);
+        slot->ir = max30102_delta_encode(ir, &ring_push_ref.ir);
+#else
+        slot->red = max30102_unpack_channel(sample_ptr);
+        slot->ir = max30102_unpack_channel(sample_ptr + 3);
+#endif
+        stream_head++;
+    }
+}
+
+#if MAX30102_RING_DELTA
+/**
+ * @brief Code one channel as the change from the previous stored value
+ * @param value New sample value
+ * @param ref Previous stored value, advanced by the coded delta
+ * @return delta, saturated to 16 bits
+ * @note A saturated delta leaves the rest of the step in ref, so the
+ *       following samples catch up instead of drifting
+ */
+static int16_t max30102_delta_encode(uint32_t value, volatile uint32_t *ref) {
+    int32_t delta = (int32_t)(value - *ref);
+    
+    if (delta > INT16_MAX) {
+        delta = INT16_MAX;
+        stream_stats.clipped++;
+    } else if (delta < INT16_MIN) {
+        delta = INT16_MIN;
+        stream_stats.clipped++;
+    }
+    
+    *ref += delta;
+    return (int16_t)delta;
+}
+#endif
+
+/**
+ * @brief Advance the asynchronous FIFO drain after each I2C transaction
+ * @param success true if the transaction completed
+ * @param context unused
+ * @note Runs in TWI interrupt context
+ */
+static void max30102_fifo_async_step(bool success, void *context) {
+    (void)context;
+    
+    if (!success) {
+        fifo_async_count = 0;
+        fifo_async_state = FIFO_ASYNC_READY;
+        return;
+    }
+    
+    switch (fifo_async_state) {
+        case FIFO_ASYNC_STATUS:
+            // Presence mode interrupts on every sample instead
+            if (!(fifo_regs[0] & (MAX30102_INT_A_FULL | MAX30102_INT_PPG_RDY))) {
+                fifo_async_state = FIFO_ASYNC_READY;
+                return;
+            }
+            
+            // WR_PTR, OVF_CNT and RD_PTR are consecutive registers
+            fifo_txn.reg_addr = MAX30102_FIFO_WR_PTR;
+            fifo_txn.data = fifo_regs;
+            fifo_txn.len = 3;
+            fifo_async_state = FIFO_ASYNC_PTRS;
+            break;
+            
+        case FIFO_ASYNC_PTRS: {
+            // Pointers are 5 bits wide, the FIFO is 32 samples deep. Equal
+            // pointers with a nonzero overflow count mean the FIFO is full.
+            uint8_t count = (fifo_regs[0] - fifo_regs[2]) & (MAX30102_FIFO_DEPTH - 1);
+            
+            if (count == 0 && fifo_regs[1] != 0) {
+                count = MAX30102_FIFO_DEPTH;
+            }
+            if (count == 0) {
+                fifo_async_state = FIFO_ASYNC_READY;
+                return;
+            }
+            
+            fifo_async_count = count;
+            fifo_txn.reg_addr = MAX30102_FIFO_DATA;
+            fifo_txn.data = fifo_raw;
+            fifo_txn.len = count * MAX30102_BYTES_PER_SAMPLE;
+            fifo_async_state = FIFO_ASYNC_DATA;
+            break;
+        }
+            
+        default:
+            fifo_async_state = FIFO_ASYNC_READY;
+            return;
+    }
+    
+    if (!i2c_submit(&fifo_txn)) {
+        fifo_async_count = 0;
+        fifo_async_state = FIFO_ASYNC_READY;
+    }
+}
+
+/**
+ * @brief Read die temperature
+ * @param temperature_c Pointer to store temperature in degrees Celsius
+ * @return true if successful, false otherwise
+ */
+bool max30102_read_temperature(float *temperature_c) {
+    uint8_t temp_int, temp_frac;
+    
+    // Trigger temperature conversion
+    if (!max30102_write_register(MAX30102_TEMP_CONFIG, 0x01)) {
+        return false;
+    }
+    
+    // Wait for temperature data to be ready
+    uint8_t int_status_2;
+    uint8_t retry = 10;
+    
+    do {
+        if (!max30102_read_register(MAX30102_INT_STATUS_2, &int_status_2)) {
+            return false;
+        }
+        
+        if (int_status_2 & MAX30102_INT_DIE_TEMP_RDY) {
+            break;
+        }
+        
+        // Simple delay
+        for (uint16_t i = 0; i < 1000; i++) {
+            asm("nop");
+        }
+        
+        retry--;
+    } while (retry > 0);
+    
+    if (retry == 0) {
+        return false;  // Timeout waiting for temperature
+    }
+    
+    // Read temperature values
+    if (!max30102_read_register(MAX30102_TEMP_INT, &temp_int)) {
+        return false;
+    }
+    
+    if (!max30102_read_register(MAX30102_TEMP_FRAC, &temp_frac)) {
+        return false;
+    }
+    
+    // Calculate temperature (integer part + fractional part)
+    // Fractional part resolution is 0.0625C
+    *temperature_c = (float)temp_int + ((float)temp_frac * 0.0625);
+    
+    return true;
+}
+
+/**
+ * @brief Read part ID
+ * @param part_id Pointer to store part ID
+ * @return true if successful, false otherwise
+ */
+bool max30102_read_part_id(uint8_t *part_id) {
+    return max30102_read_register(MAX30102_PART_ID, part_id);
+}
+
+/**
+ * @brief Read revision ID
+ * @param rev_id Pointer to store revision ID
+ * @return true if successful, false otherwise
+ */
+bool max30102_read_revision_id(uint8_t *rev_id) {
+    return max30102_read_register(MAX30102_REV_ID, rev_id);
+}
+
+/**
+ * @brief Reset the streaming heart-rate estimator
+ */
+void max30102_hr_reset(void) {
+    memset(&hr, 0, sizeof(hr));
+    hr.threshold = HR_MIN_PEAK;
+    max30102_history_reset();
+}
+
+/**
+ * @brief Feed one sample to the streaming heart-rate estimator
+ * @param sample New FIFO sample, at 100 samples/s
+ * @return true if a beat was detected on this sample, false otherwise
+ */
+bool max30102_hr_update(const max30102_fifo_sample_t *sample) {
+    int32_t x = (int32_t)sample->ir;
+    int32_t dc;
+    int32_t ac;
+    int32_t slope;
+    bool beat = false;
+    
+    bool notch = false;
+    
+    // Finger detection, restart everything when it is lifted
+    if (x < HR_FINGER_THRESHOLD) {
+        if (hr.finger) {
+            max30102_hr_reset();
+        }
+        return false;
+    }
+    if (!hr.finger) {
+        max30102_hr_reset();
+        hr.finger = true;
+        hr.dc_acc = x << HR_DC_SHIFT;
+        hr.settle = HR_SETTLE_SAMPLES;
+    }
+    
+    // DC removal with a single-pole tracker, inverted so that the
+    // absorption peak of each pulse is positive
+    hr.dc_acc += x - (hr.dc_acc >> HR_DC_SHIFT);
+    dc = hr.dc_acc >> HR_DC_SHIFT;
+    ac = dc - x;
+    
+    // Low-pass to remove sample noise, then take the slope over a short
+    // span. The pulse upstroke is the steepest part of the waveform while
+    // respiration and motion drift are slow, so peaks in the slope mark beats.
+    hr.lp += (ac - hr.lp) >> HR_LP_SHIFT;
+    slope = hr.lp - hr.lp_hist[hr.lp_index];
+    hr.lp_hist[hr.lp_index] = hr.lp;
+    hr.lp_index = (hr.lp_index + 1) & (HR_SLOPE_SPAN - 1);
+    
+    if (hr.since_beat < 0xFFFF) {
+        hr.since_beat++;
+    }
+    
+    if (hr.settle > 0) {
+        // Start the threshold at the pulse height seen while settling. From
+        // the floor it would take several beats to climb, and the dicrotic
+        // notch and noise are counted as beats on the way up.
+        if (slope > hr.peak_level) {
+            hr.peak_level = slope;
+        }
+        if (--hr.settle == 0) {
+            hr.threshold = hr.peak_level - (hr.peak_level >> 2);
+            if (hr.threshold < HR_MIN_PEAK) {
+                hr.threshold = HR_MIN_PEAK;
+            }
+        }
+    } else {
+        // Local maximum one sample ago above the adaptive threshold
+        if (hr.prev > hr.prev2 && hr.prev >= slope &&
+            hr.prev > hr.threshold && hr.since_beat > HR_REFRACTORY) {
+            
+            hr.beat_interval = 0;
+            if (hr.have_beat && hr.since_beat <= HR_MAX_INTERVAL) {
+                uint16_t interval = hr.since_beat;
+                bool accept = true;
+                
+                // Once a rhythm is established, ignore intervals off by
+                // more than half, they are missed beats or notches
+                if (hr.ibi_count >= HR_RHYTHM_INTERVALS) {
+                    uint16_t sum = 0;
+                    uint16_t avg;
+                    
+                    for (uint8_t i = 0; i < hr.ibi_count; i++) {
+                        sum += hr.ibi[i];
+                    }
+                    avg = sum / hr.ibi_count;
+                    if (interval < avg - avg / 2 || interval > avg + avg / 2) {
+                        accept = false;
+                        notch = interval < avg - avg / 2;
+                    }
+                }
+                
+                // A run of rejections means the locked rhythm was wrong,
+                // typically double counting while the threshold settled
+                if (!accept && ++hr.rejected >= 2) {
+                    hr.ibi_count = 0;
+                    hr.ibi_index = 0;
+                    max30102_history_reset();
+                    accept = true;
+                    notch = false;
+                }
+                
+                if (accept) {
+                    hr.beat_interval = interval;
+                    hr.rejected = 0;
+                    hr.ibi[hr.ibi_index] = interval;
+                    hr.ibi_index = (hr.ibi_index + 1) % HR_IBI_COUNT;
+                    if (hr.ibi_count < HR_IBI_COUNT) {
+                        hr.ibi_count++;
+                    }
+                }
+            }
+            
+            // A notch is not a beat, the next interval is still timed
+            // from the last real one so a split beat adds up again
+            if (!notch) {
+                // Track the peak height, the threshold sits at 3/4 of it
+                if (hr.peak_level == 0) {
+                    hr.peak_level = hr.prev;
+                } else {
+                    hr.peak_level += (hr.prev - hr.peak_level) >> 2;
+                }
+                hr.threshold = hr.peak_level - (hr.peak_level >> 2);
+                hr.have_beat = true;
+                hr.since_beat = 0;
+                beat = true;
+            }
+        } else {
+            // Let the threshold sink so a weaker pulse is picked up again
+            hr.threshold -= hr.threshold >> HR_THRESHOLD_DECAY;
+        }
+        
+        if (hr.threshold < HR_MIN_PEAK) {
+            hr.threshold = HR_MIN_PEAK;
+        }
+        
+        // Too long without a beat, the rhythm has to be found again and
+        // the beats of the old one say nothing about it
+        if (hr.since_beat > HR_MAX_INTERVAL && hr.have_beat) {
+            hr.have_beat = false;
+            hr.ibi_count = 0;
+            hr.ibi_index = 0;
+            max30102_history_reset();
+        }
+    }
+    
+    hr.prev2 = hr.prev;
+    hr.prev = slope;
+    
+    return beat;
+}
+
+/**
+ * @brief Read the current heart-rate estimate
+ * @param heart_rate Pointer to store the heart rate in BPM
+ * @return true if enough consistent beats were seen for a valid estimate
+ */
+bool max30102_hr_get(int32_t *heart_rate) {
+    uint16_t sum = 0;
+    
+    if (!hr.finger || hr.ibi_count < HR_MIN_INTERVALS) {
+        return false;
+    }
+    
+    for (uint8_t i = 0; i < hr.ibi_count; i++) {
+        sum += hr.ibi[i];
+    }
+    
+    // BPM = 60 * rate / interval, rounded
+    *heart_rate = ((int32_t)60 * HR_SAMPLE_RATE * hr.ibi_count + sum / 2) / sum;
+    return true;
+}
+
+/**
+ * @brief Enable or disable the automatic gain control
+ * @param enable true to let the AGC adjust LED current and ADC range
+ */
+void max30102_agc_enable(bool enable) {
+    agc.enabled = enable;
+    agc.red_sum = 0;
+    agc.ir_sum = 0;
+    agc.count = 0;
+}
+
+/**
+ * @brief Read the settings the AGC is currently using
+ * @param led Pointer to store the LED amplitudes, may be NULL
+ * @param adc_range Pointer to store the ADC range, may be NULL
+ * @return number of configuration changes made by the AGC
+ */
+uint16_t max30102_agc_get(max30102_led_amplitude_t *led, max30102_adc_range_t *adc_range) {
+    if (led) {
+        *led = current_led;
+    }
+    if (adc_range) {
+        *adc_range = current_adc_range;
+    }
+    return agc.changes;
+}
+
+/**
+ * @brief Process samples to calculate heart rate and SpO2
+ * @param samples Array of samples
+ * @param count Number of samples
+ * @param result Pointer to store the results
+ * @return true if calculation successful, false otherwise
+ */
+bool max30102_calculate_hr_spo2(max30102_fifo_sample_t *samples, uint8_t count, max30102_result_t *result) {
+    // Streamlined implementation that uses less memory
+    if (count == 0 || samples == NULL || result == NULL) {
+        return false;
+    }
+    
+    // Drop settling transients, let the AGC see the rest.
+    // The batch ends early when the AGC changed the configuration.
+    count = max30102_agc_filter(samples, count);
+    if (count == 0) {
+        return false;
+    }
+    
+    // Variables for signal analysis
+    uint32_t ir_min = 0xFFFFFFFF;
+    uint32_t ir_max = 0;
+    uint32_t ir_avg = 0;
+    uint32_t red_min = 0xFFFFFFFF;
+    uint32_t red_max = 0;
+    uint32_t red_avg = 0;
+    
+    // First pass - find min, max and avg values
+    for (uint8_t i = 0; i < count; i++) {
+        ir_avg += samples[i].ir;
+        red_avg += samples[i].red;
+        
+        if (samples[i].ir > ir_max) ir_max = samples[i].ir;
+        if (samples[i].ir < ir_min) ir_min = samples[i].ir;
+        if (samples[i].red > red_max) red_max = samples[i].red;
+        if (samples[i].red < red_min) red_min = samples[i].red;
+    }
+    
+    // Calculate averages
+    ir_avg /= count;
+    red_avg /= count;
+    
+    // Check if valid signal is present (finger on sensor)
+    bool finger_present = false;
+    
+    // If IR average is significant and there's some variation, consider finger present
+    if (ir_avg > HR_FINGER_THRESHOLD && (ir_max - ir_min) > (ir_avg / 100)) {
+        finger_present = true;
+    }
+    
+    // Calculate SpO2 (simplified)
+    if (finger_present) {
+        result->spo2_valid = max30102_spo2_from_ratio(red_max - red_min, red_avg,
+                                                      ir_max - ir_min, ir_avg,
+                                                      &result->spo2);
+    } else {
+        result->spo2_valid = false;
+    }
+    
+    // Heart rate from the streaming estimator, fed one sample at a time.
+    // Each beat adds the rate of its own interval to the smoother, not the
+    // interval average, so one bad beat shows up as spread for a few beats
+    // instead of shifting the next HR_IBI_COUNT values.
+    for (uint8_t i = 0; i < count; i++) {
+        int32_t beat_rate;
+        
+        if (max30102_hr_update(&samples[i]) && hr.beat_interval > 0 &&
+            max30102_hr_get(&beat_rate)) {
+            beat_rate = (60 * HR_SAMPLE_RATE + hr.beat_interval / 2) / hr.beat_interval;
+            max30102_history_push_hr((uint8_t)beat_rate);
+        }
+    }
+    result->hr_valid = max30102_hr_get(&result->heart_rate);
+    
+    // The DC level stepped with the new settings, start detection over
+    if (agc.rebase) {
+        agc.rebase = false;
+        max30102_hr_reset();
+    }
+    
+    if (result->spo2_valid) {
+        max30102_history_push_spo2((uint8_t)result->spo2);
+    }
+    
+    // Replace the raw values with the window averages
+    max30102_history_get(result);
+    
+    return true;
+}
+
+/**
+ * @brief Drop settling samples and feed block DC averages to the AGC
+ * @param samples Batch to filter in place
+ * @param count Number of samples in the batch
+ * @return number of usable samples left at the start of the batch
+ * @note After a configuration change the rest of the batch was taken with
+ *       the old settings and is dropped along with the FIFO and the ring
+ */
+static uint8_t max30102_agc_filter(max30102_fifo_sample_t *samples, uint8_t count) {
+    uint8_t kept = 0;
+    
+    for (uint8_t i = 0; i < count; i++) {
+        if (agc.discard > 0) {
+            agc.discard--;
+            continue;
+        }
+        samples[kept++] = samples[i];
+        
+        // Presence samples use their own settings, leave them alone
+        if (!agc.enabled || power_mode != MAX30102_POWER_ACTIVE) {
+            continue;
+        }
+        agc.red_sum += samples[i].red;
+        agc.ir_sum += samples[i].ir;
+        if (++agc.count < (1 << AGC_BLOCK_SHIFT)) {
+            continue;
+        }
+        
+        uint32_t red_dc = agc.red_sum >> AGC_BLOCK_SHIFT;
+        uint32_t ir_dc = agc.ir_sum >> AGC_BLOCK_SHIFT;
+        agc.red_sum = 0;
+        agc.ir_sum = 0;
+        agc.count = 0;
+        
+        if (max30102_agc_adjust(red_dc, ir_dc)) {
+            break;
+        }
+    }
+    
+    return kept;
+}
+
+/**
+ * @brief Move the DC levels into the middle of the ADC range
+ * @param red_dc Red DC level of the last block in ADC counts
+ * @param ir_dc IR DC level of the last block in ADC counts
+ * @return true if a new configuration was applied
+ * @note Nothing changes while both levels sit between 1/4 and 3/4 of full
+ *       scale. Otherwise both LEDs are scaled toward 1/2, preferring a more
+ *       sensitive ADC range over more LED current.
+ */
+static bool max30102_agc_adjust(uint32_t red_dc, uint32_t ir_dc) {
+    uint32_t full_scale = (1UL << (15 + current_pulse_width)) - 1;
+    uint32_t target = full_scale / 2;
+    uint8_t range = current_adc_range;
+    uint16_t red_amp, ir_amp;
+    max30102_led_amplitude_t led;
+    
+    if (ir_dc < AGC_PRESENCE) {
+        return false;
+    }
+    if (ir_dc >= full_scale / 4 && ir_dc <= full_scale - full_scale / 4 &&
+        red_dc >= full_scale / 4 && red_dc <= full_scale - full_scale / 4) {
+        return false;
+    }
+    
+    // Counts scale with LED current, aim each channel at the target
+    ir_amp = ((uint32_t)current_led.ir * target + ir_dc / 2) / ir_dc;
+    red_amp = red_dc ? ((uint32_t)current_led.red * target + red_dc / 2) / red_dc : AGC_AMP_MAX;
+    
+    // Each range step doubles or halves the counts for the same current
+    while (ir_amp > AGC_AMP_EFFICIENT && range > MAX30102_ADC_RANGE_2048_NA) {
+        range--;
+        ir_amp = (ir_amp + 1) / 2;
+        red_amp = (red_amp + 1) / 2;
+    }
+    while (ir_amp < AGC_AMP_MIN && range < MAX30102_ADC_RANGE_16384_NA) {
+        range++;
+        ir_amp *= 2;
+        red_amp *= 2;
+    }
+    
+    led.ir = (ir_amp < AGC_AMP_MIN) ? AGC_AMP_MIN : (ir_amp > AGC_AMP_MAX) ? AGC_AMP_MAX : ir_amp;
+    led.red = (red_amp < AGC_AMP_MIN) ? AGC_AMP_MIN : (red_amp > AGC_AMP_MAX) ? AGC_AMP_MAX : red_amp;
+    
+    if (led.ir == current_led.ir && led.red == current_led.red && range == current_adc_range) {
+        return false;   // Already at a limit
+    }
+    
+    // A drain in flight would deliver samples taken with the old settings,
+    // try again on the next block
+    if (max30102_fifo_read_busy()) {
+        return false;
+    }
+    
+    if (!max30102_configure(current_sample_rate, current_pulse_width,
+                            (max30102_adc_range_t)range, led)) {
+        return false;
+    }
+    
+    // Everything buffered predates the change
+    max30102_clear_fifo();
+    stream_tail = stream_head;
+    agc.discard = DISCARD_SAMPLES;
+    agc.rebase = true;
+    agc.changes++;
+    return true;
+}
+
+/**
+ * @brief Empty the result smoother
+ */
+static void max30102_history_reset(void) {
+    history_index = 0;
+    history_count = 0;
+    hr_sum = 0;
+    hr_sum_sq = 0;
+    spo2_index = 0;
+    spo2_count = 0;
+    spo2_sum = 0;
+}
+
+/**
+ * @brief Add a per-beat heart rate to the smoother
+ * @param heart_rate Heart rate in BPM
+ */
+static void max30102_history_push_hr(uint8_t heart_rate) {
+    // Retire the oldest value once the window is full
+    if (history_count == HISTORY_SIZE) {
+        uint8_t old = heart_rate_history[history_index];
+        hr_sum -= old;
+        hr_sum_sq -= (uint16_t)old * old;
+    } else {
+        history_count++;
+    }
+    
+    heart_rate_history[history_index] = heart_rate;
+    hr_sum += heart_rate;
+    hr_sum_sq += (uint16_t)heart_rate * heart_rate;
+    history_index = (history_index + 1) & (HISTORY_SIZE - 1);
+}
+
+/**
+ * @brief Add a SpO2 reading to the smoother
+ * @param spo2 SpO2 in percent
+ */
+static void max30102_history_push_spo2(uint8_t spo2) {
+    if (spo2_count == HISTORY_SIZE) {
+        spo2_sum -= spo2_history[spo2_index];
+    } else {
+        spo2_count++;
+    }
+    
+    spo2_history[spo2_index] = spo2;
+    spo2_sum += spo2;
+    spo2_index = (spo2_index + 1) & (HISTORY_SIZE - 1);
+}
+
+/**
+ * @brief Fill in the smoothed values and the stability metric
+ * @param result Result to update
+ * @note Variance is n * sum_sq - sum^2 over n^2, so no square root or
+ *       division per beat is needed to judge stability
+ */
+static void max30102_history_get(max30102_result_t *result) {
+    result->hr_confidence = 0;
+    result->hr_stable = false;
+    
+    if (spo2_count > 0 && result->spo2_valid) {
+        result->spo2 = (spo2_sum + spo2_count / 2) / spo2_count;
+    }
+    
+    if (history_count == 0 || !result->hr_valid) {
+        return;
+    }
+    
+    uint32_t n = history_count;
+    uint32_t spread = n * hr_sum_sq - (uint32_t)hr_sum * hr_sum;
+    uint32_t variance = spread / (n * n);
+    
+    result->heart_rate = (hr_sum + history_count / 2) / history_count;
+    
+    // Confidence grows with the window fill and falls with the spread
+    if (variance < HISTORY_MAX_VAR) {
+        result->hr_confidence = (uint8_t)(((HISTORY_MAX_VAR - variance) * n * 100) /
+                                          (HISTORY_MAX_VAR * HISTORY_SIZE));
+    }
+    
+    result->hr_stable = (history_count >= HISTORY_STABLE_COUNT) &&
+                        (variance <= HISTORY_STABLE_VAR);
+}
+
+/**
+ * @brief SpO2 from the red and IR perfusion ratios, integer only
+ * @param red_ac Red peak-to-peak amplitude
+ * @param red_dc Red average level
+ * @param ir_ac IR peak-to-peak amplitude
+ * @param ir_dc IR average level
+ * @param spo2 Pointer to store SpO2 in percent (70-100)
+ * @return true if the ratio could be formed, false otherwise
+ * @note R = (red_ac / red_dc) / (ir_ac / ir_dc) is formed from two Q16
+ *       perfusion indices, then looked up in a table indexed by R in Q8
+ */
+static bool max30102_spo2_from_ratio(uint32_t red_ac, uint32_t red_dc,
+                                     uint32_t ir_ac, uint32_t ir_dc, int32_t *spo2) {
+    uint32_t red_pi, ir_pi, ratio;
+    
+    if (red_dc == 0 || ir_dc == 0 || ir_ac == 0) {
+        return false;
+    }
+    if (red_ac >= SPO2_AC_LIMIT || ir_ac >= SPO2_AC_LIMIT) {
+        return false;
+    }
+    
+    // AC below 2^15 keeps the shifted values inside 32 bits
+    red_pi = (red_ac << SPO2_PI_SHIFT) / red_dc;
+    ir_pi = (ir_ac << SPO2_PI_SHIFT) / ir_dc;
+    if (ir_pi == 0 || red_pi >= (1UL << (32 - SPO2_R_SHIFT))) {
+        return false;
+    }
+    
+    ratio = (red_pi << SPO2_R_SHIFT) / ir_pi;
+    ratio >>= SPO2_LUT_SHIFT;
+    if (ratio >= SPO2_LUT_SIZE) {
+        ratio = SPO2_LUT_SIZE - 1;
+    }
+    
+    *spo2 = pgm_read_byte(&spo2_lut[ratio]);
+    return true;
+}
+
+/**
+ * @brief Shutdown the sensor
+ * @param shutdown true to enter shutdown mode, false to exit
+ * @return true if successful, false otherwise
+ */
+bool max30102_shutdown(bool shutdown) {
+    uint8_t mode_config;
+    
+    // Read current mode configuration
+    if (!max30102_read_register(MAX30102_MODE_CONFIG, &mode_config)) {
+        return false;
+    }
+    
+    // Set or clear shutdown bit
+    if (shutdown) {
+        mode_config |= MAX30102_MODE_SHDN;
+    } else {
+        mode_config &= ~MAX30102_MODE_SHDN;
+    }
+    
+    // Write updated mode configuration
+    if (!max30102_write_register(MAX30102_MODE_CONFIG, mode_config)) {
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Switch between shutdown, presence detection and full acquisition
+ * @param mode New power mode
+ * @return true if successful, false otherwise
+ */
+bool max30102_set_power_mode(max30102_power_mode_t mode) {
+    if (mode == power_mode) {
+        return true;
+    }
+    
+    // Let a drain in flight finish on the bus, its samples are from the
+    // old mode and get dropped with the ring below
+    while (fifo_async_state != FIFO_ASYNC_IDLE && fifo_async_state != FIFO_ASYNC_READY) {
+    }
+    fifo_async_state = FIFO_ASYNC_IDLE;
+    
+    switch (mode) {
+        case MAX30102_POWER_SHUTDOWN:
+            if (!max30102_shutdown(true)) {
+                return false;
+            }
+            break;
+            
+        case MAX30102_POWER_PRESENCE: {
+            // Written directly so the active configuration stays recorded
+            uint8_t spo2_config = (PRESENCE_SAMPLE_RATE << 2) | (current_pulse_width << 0);
+            spo2_config |= MAX30102_SPO2_HI_RES_EN;
+            spo2_config |= (PRESENCE_ADC_RANGE << 4);
+            
+            if (!max30102_write_register(MAX30102_SPO2_CONFIG, spo2_config)) {
+                return false;
+            }
+            if (!max30102_write_register(MAX30102_LED1_PA, 0x00)) {
+                return false;
+            }
+            if (!max30102_write_register(MAX30102_LED2_PA, PRESENCE_IR_AMPLITUDE)) {
+                return false;
+            }
+            if (!max30102_configure_fifo(PRESENCE_SAMPLE_AVG, DEFAULT_FIFO_ROLLOVER,
+                                         DEFAULT_FIFO_ALMOST_FULL)) {
+                return false;
+            }
+            
+            // A_FULL would take almost 3 s at this rate
+            if (!max30102_set_interrupt_enables(MAX30102_INT_PPG_RDY, 0x00)) {
+                return false;
+            }
+            break;
+        }
+            
+        case MAX30102_POWER_ACTIVE:
+            // Back to the settings the AGC last chose
+            if (!max30102_configure(current_sample_rate, current_pulse_width,
+                                    current_adc_range, current_led)) {
+                return false;
+            }
+            if (!max30102_configure_fifo(DEFAULT_SAMPLE_AVG, DEFAULT_FIFO_ROLLOVER,
+                                         DEFAULT_FIFO_ALMOST_FULL)) {
+                return false;
+            }
+            if (!max30102_set_interrupt_enables(MAX30102_INT_A_FULL, 0x00)) {
+                return false;
+            }
+            
+            // Start detection from scratch once the LEDs have settled
+            max30102_hr_reset();
+            max30102_agc_enable(agc.enabled);
+            agc.discard = DISCARD_SAMPLES;
+            agc.rebase = false;
+            break;
+            
+        default:
+            return false;
+    }
+    
+    // Everything buffered predates the switch
+    if (!max30102_clear_fifo()) {
+        return false;
+    }
+    stream_tail = stream_head;
+    
+    if (mode != MAX30102_POWER_SHUTDOWN && !max30102_shutdown(false)) {
+        return false;
+    }
+    
+    power_mode = mode;
+    return true;
+}
+
+/**
+ * @brief Get the current power mode
+ * @return power mode set by max30102_init() or max30102_set_power_mode()
+ */
+max30102_power_mode_t max30102_get_power_mode(void) {
+    return power_mode;
+}
+
+/**
+ * @brief Check if a finger covers the sensor
+ * @param sample Sample taken in the current power mode
+ * @return true if the IR level is above the threshold for the current mode
+ */
+bool max30102_presence_detected(const max30102_fifo_sample_t *sample) {
+    if (power_mode == MAX30102_POWER_PRESENCE) {
+        return sample->ir > PRESENCE_THRESHOLD;
+    }
+    return sample->ir > HR_FINGER_THRESHOLD;
+}
+
+/**
+ * @brief Set up interrupt handling
+ * @return true if successful, false otherwise
+ */
+bool max30102_setup_interrupt(void) {
+    // This function should be customized based on hardware setup
+    // It needs to set up the external interrupt pin (INT) connected to PD2
+    
+    // Example for ATMEGA328PB with INT connected to PD2 (INT0)
+    // Enable external interrupt INT0 on falling edge
+    EICRA = (1 << ISC01);  // Falling edge
+    EIMSK |= (1 << INT0);  // Enable INT0
+    
+    return true;
+}
+
+/**
+ * @brief Process new data when interrupt occurs
+ * @param result Pointer to store the results
+ * @return true if new data processed, false otherwise
+ */
+bool max30102_process_interrupt(max30102_result_t *result) {
+    uint8_t int_status_1, int_status_2;
+    
+    // Read and clear interrupt status
+    if (!max30102_read_interrupt_status(&int_status_1, &int_status_2)) {
+        return false;
+    }
+    
+    // Check if FIFO almost full interrupt occurred
+    if (int_status_1 & MAX30102_INT_A_FULL) {
+        max30102_fifo_sample_t samples[FIFO_READ_CHUNK];
+        uint8_t samples_read = 0;
+        bool processed = false;
+        
+        // Drain the whole FIFO, then process the ring in fixed-size batches
+        max30102_stream_drain();
+        
+        while (max30102_stream_available() > 0) {
+            samples_read = 0;
+            while (samples_read < FIFO_READ_CHUNK &&
+                   max30102_stream_pop(&samples[samples_read])) {
+                samples_read++;
+            }
+            processed |= max30102_calculate_hr_spo2(samples, samples_read, result);
+        }
+        
+        return processed;
+    }
+    
+    return false;
+}
+
+/**
+ * @brief Write to a register on the MAX30102
+ * @param reg_addr Register address
+ * @param data Data to write
+ * @return true if successful, false otherwise
+ */
+static bool max30102_write_register(uint8_t reg_addr, uint8_t data) {
+    return i2c_write_register(MAX30102_I2C_ADDR, reg_addr, data);
+}
+
+/**
+ * @brief Read from a register on the MAX30102
+ * @param reg_addr Register address
+ * @param data Pointer to store read data
+ * @return true if successful, false otherwise
+ */
+static bool max30102_read_register(uint8_t reg_addr, uint8_t *data) {
+    return i2c_read_register(MAX30102_I2C_ADDR, reg_addr, data);
+}
+
+/**
+ * @brief Read multiple registers from the MAX30102
+ * @param reg_addr Starting register address
+ * @param data Pointer to buffer to store read data
+ * @param len Number of bytes to read
+ * @return true if successful, false otherwise
+ */
+static bool max30102_read_registers(uint8_t reg_addr, uint8_t *data, uint8_t len) {
+    return i2c_read_registers(MAX30102_I2C_ADDR, reg_addr, data, len);
+}
+
+/**
+ * @brief Clear the FIFO pointers
+ * @return true if successful, false otherwise
+ */
+static bool max30102_clear_fifo(void) {
+    // Reset FIFO pointers to 0
+    if (!max30102_write_register(MAX30102_FIFO_WR_PTR, 0)) {
+        return false;
+    }
+    
+    if (!max30102_write_register(MAX30102_FIFO_RD_PTR, 0)) {
+        return false;
+    }
+    
+    if (!max30102_write_register(MAX30102_FIFO_OVF_CNT, 0)) {
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Unpack one channel of a FIFO sample
+ * @param raw Three FIFO bytes, MSB first
+ * @return Sample value at the ADC resolution
+ */
+static inline uint32_t max30102_unpack_channel(const uint8_t *raw) {
+    // Bits 23:18 are unused
+    uint32_t sample = ((uint32_t)(raw[0] & 0x03) << 16) | ((uint16_t)raw[1] << 8) | raw[2];
+    
+    return sample >> SAMPLE_SHIFT;
+}
+
+/**
+ * @brief Unpack raw FIFO bytes into samples
+ * @param raw Raw FIFO data, 6 bytes per sample, red first
+ * @param samples Array to store the samples
+ * @param count Number of samples
+ */
+static void max30102_unpack_samples(const uint8_t *raw, max30102_fifo_sample_t *samples, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        samples[i].red = max30102_unpack_channel(raw);
+        samples[i].ir = max30102_unpack_channel(raw + 3);
+        raw += MAX30102_BYTES_PER_SAMPLE;
+    }
+}
@@ -92,14 +92,38 @@ typedef struct {
     uint32_t ir;    // IR LED data
 } max30102_fifo_sample_t;
 
+// FIFO geometry
+#define MAX30102_FIFO_DEPTH          32
+#define MAX30102_BYTES_PER_SAMPLE    6  // 3 bytes RED + 3 bytes IR
+
+// Streaming acquisition ring buffer size MAX30102_RING_SIZE is set in
+// drivers_config.h, a power of two up to 128
+
+// Streaming acquisition statistics
+typedef struct {
+    uint16_t bursts;        // FIFO bursts drained into the ring
+    uint16_t overflows;     // Samples lost in the sensor FIFO (OVF_CNT)
+    uint16_t dropped;       // Samples lost because the ring was full
+    uint16_t clipped;       // Ring deltas saturated, MAX30102_RING_DELTA only
+} max30102_stream_stats_t;
+
 // Heart-rate and SpO2 results
 typedef struct {
     int32_t heart_rate;    // Heart rate in BPM
     bool hr_valid;         // Heart rate validity flag
     int32_t spo2;          // SpO2 value in percentage (0-100)
     bool spo2_valid;       // SpO2 validity flag
+    uint8_t hr_confidence; // 0-100, from window fill and beat-to-beat spread
+    bool hr_stable;        // Enough consistent beats to act on heart_rate
 } max30102_result_t;
 
+// Sensor power modes
+typedef enum {
+    MAX30102_POWER_SHUTDOWN,   // LEDs and ADC off, registers kept
+    MAX30102_POWER_PRESENCE,   // Dim IR at a low rate, only to detect a finger
+    MAX30102_POWER_ACTIVE      // Full-rate red and IR acquisition
+} max30102_power_mode_t;
+
 /**
  * @brief Initialize the MAX30102 sensor
  * @return true if successful, false otherwise
@@ -174,6 +198,57 @@ bool max30102_read_fifo_ptrs(uint8_t *write_ptr, uint8_t *read_ptr, uint8_t *ove
  */
 uint8_t max30102_read_fifo_samples(max30102_fifo_sample_t *samples, uint8_t count);
 
+/**
+ * @brief Start an interrupt-driven drain of the whole FIFO
+ * @return true if started, false if a drain is running or the I2C queue is full
+ * @note Chains interrupt status, FIFO pointer and FIFO data reads on the
+ *       asynchronous I2C engine. Collect with max30102_fifo_read_complete().
+ */
+bool max30102_fifo_read_start(void);
+
+/**
+ * @brief Check if an asynchronous FIFO drain is running or waiting to be collected
+ * @return true if busy, false if a new drain can be started
+ */
+bool max30102_fifo_read_busy(void);
+
+/**
+ * @brief Move the samples of a finished asynchronous drain into the ring
+ * @return Number of samples added, 0 if the drain is still running,
+ *         failed or found the FIFO below its almost-full threshold
+ */
+uint8_t max30102_fifo_read_complete(void);
+
+/**
+ * @brief Drain the whole FIFO into the ring using blocking I2C transfers
+ * @return Number of samples added to the ring
+ */
+uint8_t max30102_stream_drain(void);
+
+/**
+ * @brief Number of samples waiting in the ring
+ * @return Sample count
+ */
+uint8_t max30102_stream_available(void);
+
+/**
+ * @brief Take the oldest sample from the ring
+ * @param sample Pointer to store the sample
+ * @return true if a sample was returned, false if the ring is empty
+ */
+bool max30102_stream_pop(max30102_fifo_sample_t *sample);
+
+/**
+ * @brief Read the acquisition statistics
+ * @param stats Pointer to store the statistics
+ */
+void max30102_stream_get_stats(max30102_stream_stats_t *stats);
+
+/**
+ * @brief Empty the ring and clear the statistics
+ */
+void max30102_stream_reset(void);
+
 /**
  * @brief Read die temperature
  * @param temperature_c Pointer to store temperature in degrees Celsius
@@ -195,9 +270,47 @@ bool max30102_read_part_id(uint8_t *part_id);
  */
 bool max30102_read_revision_id(uint8_t *rev_id);
 
+/**
+ * @brief Reset the streaming heart-rate estimator
+ */
+void max30102_hr_reset(void);
+
+/**
+ * @brief Feed one sample to the streaming heart-rate estimator
+ * @param sample New FIFO sample, at 100 samples/s
+ * @return true if a beat was detected on this sample, false otherwise
+ * @note Integer only: DC removal, low-pass filter, adaptive-threshold peak
+ *       detection and an averaged inter-beat interval
+ */
+bool max30102_hr_update(const max30102_fifo_sample_t *sample);
+
+/**
+ * @brief Read the current heart-rate estimate
+ * @param heart_rate Pointer to store the heart rate in BPM
+ * @return true if enough consistent beats were seen for a valid estimate
+ */
+bool max30102_hr_get(int32_t *heart_rate);
+
+/**
+ * @brief Enable or disable the automatic gain control
+ * @param enable true to let the AGC adjust LED current and ADC range
+ * @note Enabled by default. The AGC runs inside max30102_calculate_hr_spo2()
+ *       on 32-sample DC averages and reconfigures through max30102_configure(),
+ *       starting from whatever max30102_configure() last set.
+ */
+void max30102_agc_enable(bool enable);
+
+/**
+ * @brief Read the settings the AGC is currently using
+ * @param led Pointer to store the LED amplitudes, may be NULL
+ * @param adc_range Pointer to store the ADC range, may be NULL
+ * @return number of configuration changes made by the AGC
+ */
+uint16_t max30102_agc_get(max30102_led_amplitude_t *led, max30102_adc_range_t *adc_range);
+
 /**
  * @brief Process samples to calculate heart rate and SpO2
- * @param samples Array of samples
+ * @param samples Array of samples, AGC settling samples are removed in place
  * @param count Number of samples
  * @param result Pointer to store the results
  * @return true if calculation successful, false otherwise
@@ -211,6 +324,31 @@ bool max30102_calculate_hr_spo2(max30102_fifo_sample_t *samples, uint8_t count,
  */
 bool max30102_shutdown(bool shutdown);
 
+/**
+ * @brief Switch between shutdown, presence detection and full acquisition
+ * @param mode New power mode
+ * @return true if successful, false otherwise
+ * @note The FIFO and the ring are emptied. Presence mode samples at 6.25 Hz
+ *       with the red LED off and interrupts on every sample, its samples are
+ *       only meant for max30102_presence_detected(). Active mode restores
+ *       the last configuration and restarts the heart-rate estimator.
+ *       Waits for a FIFO drain in flight, so interrupts must be enabled.
+ */
+bool max30102_set_power_mode(max30102_power_mode_t mode);
+
+/**
+ * @brief Get the current power mode
+ * @return power mode set by max30102_init() or max30102_set_power_mode()
+ */
+max30102_power_mode_t max30102_get_power_mode(void);
+
+/**
+ * @brief Check if a finger covers the sensor
+ * @param sample Sample taken in the current power mode
+ * @return true if the IR level is above the threshold for the current mode
+ */
+bool max30102_presence_detected(const max30102_fifo_sample_t *sample);
+
 /**
  * @brief Set up interrupt handling
  * @return true if successful, false otherwise
@@ -0,0 +1,107 @@
+/**
+ * @file rng.c
+ * @brief Entropy-seeded random number generator implementation
+ * @details The watchdog runs from its own 128 kHz oscillator, which drifts
+ *          with temperature and supply against the 16 MHz crystal. Sampling
+ *          the crystal-clocked timers from the watchdog interrupt picks up
+ *          that drift as jitter in their low bits.
+ */
+#include "rng.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+// Number of ADC conversions the pool is seeded with, one bit from each
+#define RNG_SEED_READS      32
+
+// Any non-zero value, xorshift never leaves the all-zero state
+#define RNG_STATE_FALLBACK  0x6D2B79F5UL
+
+static volatile uint32_t pool = 0;      // Entropy not yet folded into state
+static uint32_t state = 0;
+
+/**
+ * @brief Seed the pool from ADC noise and start the watchdog jitter source
+ */
+void rng_init(void) {
+    uint32_t seed = 0;
+    uint8_t i;
+
+    // ADC channel 0 is left floating, prescaler 128
+    ADMUX = 0;
+    ADCSRA = (1 << ADEN) | (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
+    for (i = 0; i < RNG_SEED_READS; i++) {
+        ADCSRA |= (1 << ADSC);
+        while (ADCSRA & (1 << ADSC));
+        // The least significant bit is the noisiest
+        seed = (seed << 1) | (ADC & 0x01);
+    }
+    ADCSRA = 0;
+    pool = seed;
+
+    // Watchdog interrupt every 16 ms, no system reset. The prescaler and
+    // mode can only change within 4 cycles of setting WDCE and WDE.
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        MCUSR &= ~(1 << WDRF);
+        WDTCSR = (1 << WDCE) | (1 << WDE);
+        WDTCSR = (1 << WDIE);
+    }
+}
+
+/**
+ * @brief Mix a value into the entropy pool
+ * @param value raw noise
+ */
+void rng_add_entropy(uint16_t value) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        // Rotate so repeated values do not cancel out
+        pool = ((pool << 5) | (pool >> 27)) ^ value;
+    }
+}
+
+/**
+ * @brief Next random value
+ * @return uniformly distributed 16-bit value
+ */
+uint16_t rng_next(void) {
+    // Fold in whatever entropy arrived since the last draw, the same work
+    // is done whether the pool holds new bits or not
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        state ^= pool;
+        pool = 0;
+    }
+    if (state == 0) {
+        state = RNG_STATE_FALLBACK;
+    }
+
+    // xorshift32 (13, 17, 5)
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    // The high half has the better distribution
+    return (uint16_t)(state >> 16);
+}
+
+/**
+ * @brief Value to keep across power cycles for rng_restore()
+ * @return 32 fresh random bits
+ */
+uint32_t rng_save(void) {
+    return ((uint32_t)rng_next() << 16) | rng_next();
+}
+
+/**
+ * @brief Mix a value kept from the last power cycle into the pool
+ * @param seed value returned by rng_save()
+ */
+void rng_restore(uint32_t seed) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        pool ^= seed;
+    }
+}
+
+// Watchdog jitter source, both timers free-run from the crystal
+ISR(WDT_vect) {
+    rng_add_entropy(((uint16_t)TCNT2 << 8) | TCNT0);
+}
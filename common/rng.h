@@ -0,0 +1,79 @@
+/**
+ * @file rng.h
+ * @brief Entropy-seeded random number generator for ATMEGA328PB
+ * @details A 32-bit entropy pool collects ADC noise at start-up, the phase of
+ *          the watchdog oscillator against Timer2 and the low bits of the PPG
+ *          samples. Every draw folds the pool into a xorshift32 state, so the
+ *          cost of a draw is the same whatever the state or the pool holds.
+ *          rng_range() maps draws onto 0..n-1 without bias and without a
+ *          division on the common path.
+ */
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+/**
+ * @brief Seed the pool from ADC noise and start the watchdog jitter source
+ * @details Uses ADC channel 0 and leaves the ADC disabled afterwards. The
+ *          watchdog runs in interrupt-only mode with a 16 ms period and never
+ *          resets the CPU. Call before sei().
+ * @return none
+ */
+void rng_init(void);
+
+/**
+ * @brief Mix a value into the entropy pool, safe from ISRs and main context
+ * @param value raw noise, only its changing low bits need to be random
+ * @return none
+ */
+void rng_add_entropy(uint16_t value);
+
+/**
+ * @brief Next random value
+ * @return uniformly distributed 16-bit value
+ */
+uint16_t rng_next(void);
+
+/**
+ * @brief Value to keep across power cycles for rng_restore()
+ * @return 32 fresh random bits, the state itself is not exposed
+ */
+uint32_t rng_save(void);
+
+/**
+ * @brief Mix a value kept from the last power cycle into the pool
+ * @details Adds to the ADC seed instead of replacing it, so a stale or
+ *          repeated value never makes two boots draw the same sequence
+ *          unless the ADC noise matched as well.
+ * @param seed value returned by rng_save()
+ * @return none
+ */
+void rng_restore(uint32_t seed);
+
+/**
+ * @brief Uniform random value in 0..n-1
+ * @details Lemire's multiply-shift: the high half of rng_next() * n is the
+ *          result, draws whose low half falls in the (65536 % n) biased slots
+ *          are rejected. The modulo only runs when the low half is below n,
+ *          and folds to a constant when n is known at compile time.
+ * @param n number of possible values, 1 to 65535
+ * @return value from 0 to n-1
+ */
+static inline uint16_t rng_range(uint16_t n)
+{
+    uint32_t m = (uint32_t)rng_next() * n;
+    uint16_t low = (uint16_t)m;
+
+    if (low < n) {
+        uint16_t threshold = (uint16_t)(0x10000UL % n);
+        while (low < threshold) {
+            m = (uint32_t)rng_next() * n;
+            low = (uint16_t)m;
+        }
+    }
+    return (uint16_t)(m >> 16);
+}
+
+#endif /* RNG_H */
@@ -0,0 +1,86 @@
+/**
+ * @file telemetry.c
+ * @brief Framed binary stream of raw MAX30102 samples over the UART
+ * @details Frames are assembled on the stack and queued only if the UART
+ *          transmit buffer can take the whole frame, so a frame is never
+ *          cut short by the drop policy.
+ */
+
+#include "telemetry.h"
+#include "uart.h"
+#include <util/crc16.h>
+
+#define TELEMETRY_SAMPLE_MASK   0x3FFFFUL   // 18-bit ADC value
+
+static uint8_t sequence = 0;
+static uint16_t dropped = 0;
+
+/**
+ * @brief Append the low bits of value to the packed payload
+ * @param out Payload write position, advanced past every completed byte
+ * @param acc Bit accumulator, holds fewer than 8 pending bits between calls
+ * @param pending Number of pending bits in acc
+ * @param value Value to append, 18 bits
+ */
+static void pack_18(uint8_t **out, uint32_t *acc, uint8_t *pending, uint32_t value) {
+    *acc = (*acc << 18) | (value & TELEMETRY_SAMPLE_MASK);
+    *pending += 18;
+    while (*pending >= 8) {
+        *pending -= 8;
+        *(*out)++ = (uint8_t)(*acc >> *pending);
+    }
+}
+
+/**
+ * @brief Send up to TELEMETRY_MAX_SAMPLES samples as one frame
+ */
+bool telemetry_send_samples(const max30102_fifo_sample_t *samples, uint8_t count) {
+    uint8_t frame[TELEMETRY_FRAME_SIZE(TELEMETRY_MAX_SAMPLES)];
+    uint8_t *out = frame;
+    uint32_t acc = 0;
+    uint8_t pending = 0;
+    uint16_t crc = 0xFFFF;
+    uint8_t length, i;
+
+    if (count == 0) {
+        return true;
+    }
+    if (count > TELEMETRY_MAX_SAMPLES) {
+        count = TELEMETRY_MAX_SAMPLES;
+    }
+
+    *out++ = TELEMETRY_SYNC;
+    *out++ = sequence++;
+    *out++ = count;
+    for (i = 0; i < count; i++) {
+        pack_18(&out, &acc, &pending, samples[i].red);
+        pack_18(&out, &acc, &pending, samples[i].ir);
+    }
+    if (pending > 0) {
+        *out++ = (uint8_t)(acc << (8 - pending));   // Zero-pad the last byte
+    }
+
+    // CRC covers everything after the sync byte
+    for (uint8_t *p = frame + 1; p < out; p++) {
+        crc = _crc_xmodem_update(crc, *p);
+    }
+    *out++ = crc >> 8;
+    *out++ = crc;
+
+    length = out - frame;
+    if (uart_tx_free() < length) {
+        dropped++;
+        return false;
+    }
+    for (i = 0; i < length; i++) {
+        uart_send(frame[i], NULL);
+    }
+    return true;
+}
+
+/**
+ * @brief Number of frames dropped because the UART buffer was full
+ */
+uint16_t telemetry_dropped(void) {
+    return dropped;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file telemetry.h
+ * @brief Framed binary stream of raw MAX30102 samples over the UART
+ * @details Replaces per-sample printf output so the full sample rate can be
+ *          recorded and the HR algorithm tuned offline, see
+ *          tools/telemetry_decode.py for the host side.
+ *
+ *          Frame layout, all multi-byte fields big-endian:
+ *              0xA5                sync
+ *              seq                 frame counter, increments for every frame
+ *                                  built, including dropped ones
+ *              count               samples in the frame, 1..TELEMETRY_MAX_SAMPLES
+ *              payload             count red/IR pairs, 18 bits each, packed MSB
+ *                                  first into (count * 36 + 7) / 8 bytes
+ *              crc                 CRC-16/CCITT-FALSE over seq, count, payload
+ *
+ *          At 100 samples/s in frames of 10 this is 500 bytes/s, which fits
+ *          9600 baud 8N2 (872 bytes/s) with room for the text log.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "max30102.h"
+
+#define TELEMETRY_SYNC          0xA5
+#define TELEMETRY_MAX_SAMPLES   10
+
+// Header (sync, seq, count) and CRC around the packed samples
+#define TELEMETRY_FRAME_SIZE(n) (3 + ((n) * 36 + 7) / 8 + 2)
+
+/**
+ * @brief Send up to TELEMETRY_MAX_SAMPLES samples as one frame
+ * @param samples Samples to send, only the low 18 bits of each channel are used
+ * @param count Number of samples, larger counts are truncated
+ * @return true if the frame was queued, false if the UART buffer had no room
+ *         and the frame was dropped
+ * @note Never blocks, a dropped frame shows up as a sequence gap on the host
+ */
+bool telemetry_send_samples(const max30102_fifo_sample_t *samples, uint8_t count);
+
+/**
+ * @brief Number of frames dropped because the UART buffer was full
+ * @return dropped frame count
+ */
+uint16_t telemetry_dropped(void);
+
+#endif // TELEMETRY_H
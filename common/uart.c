@@ -1,9 +1,30 @@
 #include <stdio.h>
 #include "uart.h"
 #include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
 #include <stdarg.h>
 #include <string.h>
 
+#define UART_TX_MASK (UART_TX_BUFFER_SIZE - 1)
+
+#if (UART_TX_BUFFER_SIZE < 2) || (UART_TX_BUFFER_SIZE > 256) || (UART_TX_BUFFER_SIZE & UART_TX_MASK)
+#error "UART_TX_BUFFER_SIZE must be a power of two from 2 to 256"
+#endif
+
+static volatile char tx_buffer[UART_TX_BUFFER_SIZE];
+static volatile uint8_t tx_head;        // Next free slot, written by uart_send
+static volatile uint8_t tx_tail;        // Next byte to send, written by the ISR
+static volatile uint16_t tx_dropped;    // Characters lost to UART_TX_DROP
+
+// Move one byte from the buffer to the USART, caller checked UDRE0 and that
+// the buffer is not empty
+static inline void uart_tx_next(void)
+{
+    UDR0 = tx_buffer[tx_tail];
+    tx_tail = (tx_tail + 1) & UART_TX_MASK;
+}
+
 void uart_init()
 {
     /*Set baud rate */
@@ -21,11 +42,75 @@ void uart_init()
 
 int uart_send(char data, FILE* stream)
 {
-    // Wait for empty transmit buffer
-    while(!(UCSR0A & (1<<UDRE0)));
-    // Put data into buffer and send data
-    UDR0 = data;
-    return 0;
+    while (1) {
+        // Claim a slot atomically, printf may also run in interrupt context
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            uint8_t next = (tx_head + 1) & UART_TX_MASK;
+
+            if (next != tx_tail) {
+                tx_buffer[tx_head] = data;
+                tx_head = next;
+                // Data register empty interrupt drains the buffer
+                UCSR0B |= (1<<UDRIE0);
+                return 0;
+            }
+        }
+
+#if UART_TX_OVERFLOW == UART_TX_BLOCK
+        // Buffer full. With interrupts off the ISR cannot make room, so send
+        // the oldest byte here, otherwise just wait for the ISR
+        if (!(SREG & (1<<SREG_I)) && (UCSR0A & (1<<UDRE0))) {
+            uart_tx_next();
+        }
+#else
+        tx_dropped++;
+        return 0;
+#endif
+    }
+}
+
+// Wait until every buffered character has been handed to the USART
+void uart_flush(void)
+{
+    while (tx_head != tx_tail) {
+        if (!(SREG & (1<<SREG_I)) && (UCSR0A & (1<<UDRE0))) {
+            uart_tx_next();
+        }
+    }
+    while (!(UCSR0A & (1<<UDRE0)));
+}
+
+// Characters discarded because the buffer was full
+uint16_t uart_tx_dropped(void)
+{
+    uint16_t dropped;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        dropped = tx_dropped;
+    }
+    return dropped;
+}
+
+// Free space in the transmit buffer, one slot always stays empty
+uint8_t uart_tx_free(void)
+{
+    uint8_t used;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        used = (tx_head - tx_tail) & UART_TX_MASK;
+    }
+    return (UART_TX_BUFFER_SIZE - 1) - used;
+}
+
+// Send the next buffered byte, disable the interrupt once the buffer is empty
+ISR(USART0_UDRE_vect)
+{
+    if (tx_head != tx_tail) {
+        uart_tx_next();
+    }
+    if (tx_head == tx_tail) {
+        UCSR0B &= ~(1<<UDRIE0);
+    }
 }
 
 int uart_receive(FILE* stream)
@@ -34,6 +119,7 @@ int uart_receive(FILE* stream)
     return UDR0;
 }
 
+#if UART_ENABLE_SCANF
 void determine_line_ending() {
     char c;
     printf("Press Enter to detect the line ending style...\n");
@@ -168,4 +254,5 @@ void uart_scanf(const char* format, ...)
 #else
 #error "MAX_STRING_LENGTH undefined"
 #endif
-#endif
\ No newline at end of file
+#endif
+#endif // UART_ENABLE_SCANF
\ No newline at end of file
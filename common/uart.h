@@ -2,11 +2,19 @@
 #define UART_H
 
 #include <stdio.h>
+#include <stdint.h>
+#include "drivers_config.h"
 
 /***************************************/
 /* USER CONFIG */
 /***************************************/
 
+/*
+ * Baud rate, transmit buffer size and overflow policy are set in
+ * drivers_config.h. The settings below are only used by uart_scanf(),
+ * which is built with UART_ENABLE_SCANF=1.
+ */
+
 /**
  * Line termination type that your terminal emulator follows
  *      \r  :   #define CR
@@ -25,35 +33,38 @@
  */
 #define MAX_STRING_LENGTH   100
 
-/**
- * Set UART baud rate
- * This has been tested to work fine with 9600
- * 
- * If using other baud rates, slight adjustments may need to be made
- * to the UART_BAUD_PRESCALER macro (add or subtract a few counts)
- * due to baud rate error
- */
-#define UART_BAUD_RATE      9600
-
 /***************************************/
 /* MACROS AND FUNCTION DECLARATIONS */
 /***************************************/
 
-#ifndef F_CPU
-    #warning "F_CPU not defined. Defaulting to 16MHz"
-    #define F_CPU 16000000UL
-#endif
-
+/**
+ * If using baud rates other than 9600, slight adjustments may need to be
+ * made to the UART_BAUD_PRESCALER macro (add or subtract a few counts)
+ * due to baud rate error
+ *
+ * uart_send() only copies into the transmit buffer, the USART data register
+ * empty interrupt sends it out in the background. With interrupts disabled
+ * (inside an ISR) UART_TX_BLOCK sends from the buffer by polling, so it
+ * cannot deadlock but does stall for the duration
+ */
 #define UART_BAUD_PRESCALER (((F_CPU / (UART_BAUD_RATE * 16UL))) - 1)
 
 void uart_init(void);
 
 int uart_send(char data, FILE* stream);
 
+void uart_flush(void);
+
+uint16_t uart_tx_dropped(void);
+
+uint8_t uart_tx_free(void);
+
 int uart_receive(FILE* stream);
 
+#if UART_ENABLE_SCANF
 void uart_scanf(const char* format, ...);
 
 void determine_line_ending(void);
+#endif
 
 #endif // UART_H
\ No newline at end of file
@@ -0,0 +1,272 @@
+/**
+ * @file bench.c
+ * @brief On-target benchmark implementation
+ * @details Timer1 runs free at clk/1 and its overflow interrupt supplies the
+ *          upper 16 bits, so one count is one CPU cycle. The cost of reading
+ *          the counter twice around an empty case is measured first and
+ *          taken off every result. Cycles include the interrupts that
+ *          preempt a run, which the UART drain keeps down to the Timer1
+ *          overflow itself.
+ */
+
+#include "drivers_config.h"
+#include "bench.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "uart.h"
+#include "i2c.h"
+#include "max30102.h"
+#include "ST7735.h"
+#include "LCD_GFX.h"
+#include "rng.h"
+
+// Only the benchmark build claims Timer1 and the sample buffers
+#if HRTEST_BENCHMARK
+
+#if LCD_PROFILE
+#error "The benchmark owns Timer1, build it with LCD_PROFILE 0"
+#endif
+
+// Free RAM is filled with this before a run, the lowest changed byte is
+// the deepest the stack went
+#define BENCH_PAINT         0xC5
+
+// Bytes left unpainted below the painting function's own frame
+#define BENCH_PAINT_GUARD   16
+
+// Same burst as a full FIFO drain
+#define BENCH_FIFO_SAMPLES  MAX30102_FIFO_DEPTH
+#define BENCH_FIFO_BYTES    (MAX30102_FIFO_DEPTH * MAX30102_BYTES_PER_SAMPLE)
+
+// Win odds draw of the slot game, not a power of two
+#define BENCH_RNG_RANGE     100
+
+typedef struct {
+    const char *name;
+    void (*setup)(void);                // Untimed, runs before each timed call
+    bool (*run)(void);
+} bench_case_t;
+
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint32_t total;
+    uint16_t stack;                     // Deepest stack in bytes below RAMEND
+    uint8_t failures;
+} bench_stats_t;
+
+extern uint8_t __heap_start;            // First byte after .data and .bss
+
+static volatile uint16_t overflows = 0; // Upper half of the cycle counter
+static uint32_t overhead = 0;           // Cycles of an empty case
+
+// The raw burst and the unpacked samples are never needed at once
+static union {
+    uint8_t raw[BENCH_FIFO_BYTES];
+    max30102_fifo_sample_t samples[BENCH_FIFO_SAMPLES];
+} fifo;
+
+// Input to the DSP, refreshed before each run as the AGC filter edits it
+static max30102_fifo_sample_t work[BENCH_FIFO_SAMPLES];
+static max30102_result_t result;
+static volatile uint16_t sink;
+
+// Extend the free-running Timer1 to a 32-bit cycle counter
+ISR(TIMER1_OVF_vect) {
+    overflows++;
+}
+
+/**
+ * @brief Read the 32-bit cycle counter
+ * @return cycles since bench_init(), an overflow still pending is counted
+ */
+static uint32_t bench_cycles(void) {
+    uint8_t sreg = SREG;
+    uint16_t ticks, high;
+
+    cli();
+    ticks = TCNT1;
+    high = overflows;
+    if ((TIFR1 & (1 << TOV1)) && ticks < 0x8000) {
+        high++;     // Wrapped after cli(), ISR still pending
+    }
+    SREG = sreg;
+
+    return ((uint32_t)high << 16) | ticks;
+}
+
+/**
+ * @brief Fill the free RAM between the heap start and the stack
+ */
+static void bench_paint(void) {
+    uint8_t *p = &__heap_start;
+    uint8_t *top = (uint8_t *)(uintptr_t)SP - BENCH_PAINT_GUARD;
+
+    while (p < top) {
+        *p++ = BENCH_PAINT;
+    }
+}
+
+/**
+ * @brief Deepest the stack went since bench_paint()
+ * @return bytes from the lowest changed address up to RAMEND
+ */
+static uint16_t bench_stack_depth(void) {
+    const uint8_t *p = &__heap_start;
+
+    while (*p == BENCH_PAINT) {
+        p++;
+    }
+    return (uint16_t)(RAMEND - (uintptr_t)p + 1);
+}
+
+static bool bench_nothing(void) {
+    return true;
+}
+
+static bool bench_draw_char(void) {
+    LCD_drawChar(0, 0, 'A', WHITE, BLACK);
+    return true;
+}
+
+static bool bench_draw_block(void) {
+    LCD_drawBlock(0, 0, 39, 39, BLUE);
+    return true;
+}
+
+static bool bench_set_screen(void) {
+    LCD_setScreen(BLACK);
+    return true;
+}
+
+static bool bench_i2c_burst(void) {
+    return i2c_read_registers(MAX30102_I2C_ADDR, MAX30102_FIFO_DATA,
+                              fifo.raw, BENCH_FIFO_BYTES);
+}
+
+static bool bench_fifo_samples(void) {
+    return max30102_read_fifo_samples(fifo.samples, BENCH_FIFO_SAMPLES) == BENCH_FIFO_SAMPLES;
+}
+
+static void bench_dsp_setup(void) {
+    memcpy(work, fifo.samples, sizeof(work));
+}
+
+static bool bench_dsp(void) {
+    // No finger gives no valid reading, but the same work is done
+    max30102_calculate_hr_spo2(work, BENCH_FIFO_SAMPLES, &result);
+    return true;
+}
+
+static bool bench_rng_range(void) {
+    sink = rng_range(BENCH_RNG_RANGE);
+    return true;
+}
+
+// The FIFO read comes before the DSP so it has real samples to work on
+static const bench_case_t cases[] = {
+    { "LCD_drawChar",           NULL,               bench_draw_char },
+    { "LCD_drawBlock 40x40",    NULL,               bench_draw_block },
+    { "LCD_setScreen",          NULL,               bench_set_screen },
+    { "i2c_read_registers 192", NULL,               bench_i2c_burst },
+    { "read_fifo_samples 32",   NULL,               bench_fifo_samples },
+    { "calculate_hr_spo2 32",   bench_dsp_setup,    bench_dsp },
+    { "rng_range 100",          NULL,               bench_rng_range },
+};
+
+/**
+ * @brief Run one case BENCH_RUNS times
+ * @param bench Case to time
+ * @param stats Filled with the results, overhead already taken off
+ */
+static void bench_measure(const bench_case_t *bench, bench_stats_t *stats) {
+    uint32_t start, cycles;
+    uint16_t depth;
+    bool ok;
+    uint8_t i;
+
+    stats->min = UINT32_MAX;
+    stats->max = 0;
+    stats->total = 0;
+    stats->stack = 0;
+    stats->failures = 0;
+
+    for (i = 0; i < BENCH_RUNS; i++) {
+        if (bench->setup) {
+            bench->setup();
+        }
+        uart_flush();
+        bench_paint();
+
+        start = bench_cycles();
+        ok = bench->run();
+        cycles = bench_cycles() - start;
+
+        depth = bench_stack_depth();
+        cycles = (cycles > overhead) ? cycles - overhead : 0;
+
+        if (!ok) stats->failures++;
+        if (cycles < stats->min) stats->min = cycles;
+        if (cycles > stats->max) stats->max = cycles;
+        if (depth > stats->stack) stats->stack = depth;
+        stats->total += cycles;
+    }
+}
+
+/**
+ * @brief Start the LCD and the Timer1 cycle counter
+ */
+void bench_init(void) {
+    lcd_init();
+
+    TCCR1A = 0;                 // Normal mode, counts 0 to 0xFFFF
+    TCCR1B = (1 << CS10);       // clk/1
+    TCNT1 = 0;
+    TIFR1 = (1 << TOV1);
+    TIMSK1 |= (1 << TOIE1);
+    overflows = 0;
+}
+
+/**
+ * @brief Time every primitive and print the table
+ */
+bool bench_run(void) {
+    const bench_case_t empty = { "empty", NULL, bench_nothing };
+    bench_stats_t stats;
+    bool all_ok = true;
+    uint8_t i;
+
+    // Keep the sensor settings fixed, the AGC would change them between runs
+    max30102_agc_enable(false);
+
+    overhead = 0;
+    bench_measure(&empty, &stats);
+    overhead = stats.min;
+
+    printf("\r\nBenchmark, %u runs each, %lu cycles per us\r\n",
+           BENCH_RUNS, F_CPU / 1000000UL);
+    printf("Counter overhead %lu cycles, stack at call %u bytes\r\n",
+           overhead, (uint16_t)(RAMEND - SP));
+    printf("%-24s %9s %9s %9s %8s %6s %5s\r\n",
+           "primitive", "min", "avg", "max", "avg us", "stack", "fail");
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        uint32_t avg;
+
+        bench_measure(&cases[i], &stats);
+        avg = stats.total / BENCH_RUNS;
+        printf("%-24s %9lu %9lu %9lu %8lu %6u %5u\r\n",
+               cases[i].name, stats.min, avg, stats.max,
+               avg / (F_CPU / 1000000UL), stats.stack, stats.failures);
+        if (stats.failures) {
+            all_ok = false;
+        }
+    }
+
+    return all_ok;
+}
+
+#endif /* HRTEST_BENCHMARK */
@@ -0,0 +1,37 @@
+/**
+ * @file bench.h
+ * @brief On-target benchmarks of the shared drivers and the DSP
+ * @details Built into hrtest.X when HRTEST_BENCHMARK is 1, see
+ *          project_config.h. Each primitive runs BENCH_RUNS times with
+ *          Timer1 counting CPU cycles, and the RAM below the stack is
+ *          painted before every run to find how deep it went. The results
+ *          are printed over the UART as one table row per primitive.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdbool.h>
+
+// Runs per primitive, the full-screen fill takes ~40 ms each
+#define BENCH_RUNS          16
+
+/**
+ * @brief Start the LCD and the Timer1 cycle counter
+ * @details Timer1 and its overflow interrupt belong to the benchmark from
+ *          here on, so it cannot be built together with LCD_PROFILE. Call
+ *          after init_peripherals() and before sei().
+ * @return none
+ */
+void bench_init(void);
+
+/**
+ * @brief Time every primitive and print the table
+ * @details Needs interrupts enabled, runs longer than 4 ms count on the
+ *          Timer1 overflow interrupt. The UART is drained before each run
+ *          so its interrupt does not land in the numbers.
+ * @return true if every run of every primitive succeeded
+ */
+bool bench_run(void);
+
+#endif /* BENCH_H */
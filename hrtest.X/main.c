@@ -3,6 +3,7 @@
  * @brief Heart rate and SpO2 monitoring using MAXREFDES117# with ATMEGA328PB
  */
 
+#include "drivers_config.h"
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
@@ -13,13 +14,27 @@
 #include "uart.h"
 #include "i2c.h"
 #include "max30102.h"
+#include "telemetry.h"
+#include "bench.h"
 
 // Define I2C frequency
 #define I2C_FREQUENCY      400000UL  // 400kHz for MAX30102 communication
 
-// Define the number of samples to read in each iteration
+// Number of samples handed to the DSP per batch
 #define SAMPLE_COUNT       10
 
+#if HRTEST_TELEMETRY && (SAMPLE_COUNT > TELEMETRY_MAX_SAMPLES)
+#error "SAMPLE_COUNT batches do not fit in one telemetry frame"
+#endif
+
+// The frames take 500 bytes/s of the UART, so next to them a result row is
+// only printed about once a second
+#if HRTEST_TELEMETRY
+#define ROW_BATCHES        (100 / SAMPLE_COUNT)
+#else
+#define ROW_BATCHES        1
+#endif
+
 // Global variable for interrupt data
 volatile bool new_data_ready = false;
 
@@ -120,9 +135,9 @@ int main(void) {
     // Variables for heart rate and SpO2 calculation
     max30102_result_t result;
     uint8_t sample_count;
-    uint8_t write_ptr, read_ptr, overflow;
     uint8_t int_status_1, int_status_2;
-    uint32_t loop_count = 0;
+    uint32_t red, ir;
+    uint8_t batches = 0;
     
     // Initialize peripherals
     if (!init_peripherals()) {
@@ -135,9 +150,21 @@ int main(void) {
     // Print sensor information
     print_sensor_info();
     
+#if HRTEST_BENCHMARK
+    bench_init();
+#endif
+    
     // Enable global interrupts
     sei();
     
+#if HRTEST_BENCHMARK
+    // Benchmark build, repeat the timing table instead of the sample loop
+    while (1) {
+        bench_run();
+        _delay_ms(5000);
+    }
+#endif
+    
     // Print header
     printf("\r\nHeart Rate and SpO2 Monitoring:\r\n");
     printf("--------------------------------\r\n");
@@ -145,83 +172,53 @@ int main(void) {
     
     // Main loop
     while (1) {
-        loop_count++;
-        
-        // Check for interrupts via interrupt pin (should set new_data_ready)
-        if (new_data_ready) {
-            // printf("INT triggered!\r\n");
+        // The INT pin stays low until the status is read, so also check the
+        // level in case an edge arrived before interrupts were enabled
+        if (new_data_ready || !(PIND & (1 << PD3))) {
             new_data_ready = false;
-        }
-
-        // Check for interrupts via register polling every 20 iterations
-        if (loop_count % 20 == 0) {
-            // Read interrupt status
-            if (max30102_read_interrupt_status(&int_status_1, &int_status_2)) {
-                if (int_status_1 & MAX30102_INT_A_FULL) {
-                    // printf("INT detected via polling: 0x%02X\r\n", int_status_1);
-                    
-                    // Read FIFO pointers to determine how many samples to read
-                    if (max30102_read_fifo_ptrs(&write_ptr, &read_ptr, &overflow)) {
-                        // Calculate number of samples to read
-                        if (write_ptr >= read_ptr) {
-                            sample_count = write_ptr - read_ptr;
-                        } else {
-                            sample_count = 32 - read_ptr + write_ptr;  // FIFO is 32 samples deep
-                        }
-                        
-                        // Print FIFO status
-                        // printf("FIFO: W=%u R=%u OVF=%u Count=%u\r\n", write_ptr, read_ptr, overflow, sample_count);
-                        
-                        // Cap sample count to buffer size
-                        if (sample_count > SAMPLE_COUNT) {
-                            sample_count = SAMPLE_COUNT;
-                        }
-                        
-                        // Only process data if we have enough samples
-                        if (sample_count >= 5) {
-                            // Read samples from FIFO
-                            sample_count = max30102_read_fifo_samples(samples, sample_count);
-                            
-                            // Process samples to calculate heart rate and SpO2
-                            if (max30102_calculate_hr_spo2(samples, sample_count, &result)) {
-                                // Print sample data and results
-                                for (uint8_t i = 0; i < sample_count && i < 1; i++) {
-                                    printf("%lu\t%lu\t", samples[i].red, samples[i].ir);
-                                }
-                                
-                                // Print heart rate and validity
-                                if (result.hr_valid) {
-                                    printf("%ld\tValid\t\t", result.heart_rate);
-                                } else {
-                                    printf("--\tInvalid\t\t");
-                                }
-                                
-                                // Print SpO2 and validity
-                                if (result.spo2_valid) {
-                                    printf("%ld%%\tValid\r\n", result.spo2);
-                                } else {
-                                    printf("--%%\tInvalid\r\n");
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+            max30102_read_interrupt_status(&int_status_1, &int_status_2);
+            
+            // Every sample goes through the ring, the DSP needs all of them
+            max30102_stream_drain();
         }
         
-        // Check interrupt pin state manually every 50 iterations
-        if (loop_count % 50 == 0) {
-            // Read PD3 pin state
-            if (!(PIND & (1 << PD3))) {
-                // printf("INT pin is LOW\r\n");
+        // Feed the DSP from the ring in batches, one output row per batch
+        while (max30102_stream_available() > 0) {
+            sample_count = 0;
+            while (sample_count < SAMPLE_COUNT && max30102_stream_pop(&samples[sample_count])) {
+                sample_count++;
+            }
+            
+#if HRTEST_TELEMETRY
+            // Wait for room instead of dropping, the capture needs every frame
+            while (uart_tx_free() < TELEMETRY_FRAME_SIZE(sample_count));
+            telemetry_send_samples(samples, sample_count);
+#endif
+            
+            // The DSP filters the batch in place, keep the raw first sample
+            red = samples[0].red;
+            ir = samples[0].ir;
+            
+            // Process samples to calculate heart rate and SpO2
+            if (max30102_calculate_hr_spo2(samples, sample_count, &result) &&
+                ++batches >= ROW_BATCHES) {
+                batches = 0;
+                printf("%lu\t%lu\t", red, ir);
+                
+                // Print heart rate and validity
+                if (result.hr_valid) {
+                    printf("%ld\tValid\t\t", result.heart_rate);
+                } else {
+                    printf("--\tInvalid\t\t");
+                }
+                
+                // Print SpO2 and validity
+                if (result.spo2_valid) {
+                    printf("%ld%%\tValid\r\n", result.spo2);
+                } else {
+                    printf("--%%\tInvalid\r\n");
+                }
             }
-        }
-        
-        // Every 100 loops, reconfigure interrupts to ensure they're enabled
-        if (loop_count % 100 == 0) {
-            // Re-enable FIFO almost full interrupt
-            max30102_set_interrupt_enables(MAX30102_INT_A_FULL, 0x00);
-            // printf("Reconfigured interrupts\r\n");
         }
         
         // Small delay to allow sensor to collect data
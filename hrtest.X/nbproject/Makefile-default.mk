@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=LCD_GFX.c ST7735.c main.c uart.c i2c.c max30102.c
+SOURCEFILES_QUOTED_IF_SPACED=../common/LCD_GFX.c ../common/ST7735.c main.c ../common/uart.c ../common/i2c.c ../common/max30102.c ../common/rng.c bench.c ../common/telemetry.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/LCD_GFX.o ${OBJECTDIR}/ST7735.o ${OBJECTDIR}/main.o ${OBJECTDIR}/uart.o ${OBJECTDIR}/i2c.o ${OBJECTDIR}/max30102.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/LCD_GFX.o.d ${OBJECTDIR}/ST7735.o.d ${OBJECTDIR}/main.o.d ${OBJECTDIR}/uart.o.d ${OBJECTDIR}/i2c.o.d ${OBJECTDIR}/max30102.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1270477542/LCD_GFX.o ${OBJECTDIR}/_ext/1270477542/ST7735.o ${OBJECTDIR}/main.o ${OBJECTDIR}/_ext/1270477542/uart.o ${OBJECTDIR}/_ext/1270477542/i2c.o ${OBJECTDIR}/_ext/1270477542/max30102.o ${OBJECTDIR}/_ext/1270477542/rng.o ${OBJECTDIR}/bench.o ${OBJECTDIR}/_ext/1270477542/telemetry.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d ${OBJECTDIR}/_ext/1270477542/ST7735.o.d ${OBJECTDIR}/main.o.d ${OBJECTDIR}/_ext/1270477542/uart.o.d ${OBJECTDIR}/_ext/1270477542/i2c.o.d ${OBJECTDIR}/_ext/1270477542/max30102.o.d ${OBJECTDIR}/_ext/1270477542/rng.o.d ${OBJECTDIR}/bench.o.d ${OBJECTDIR}/_ext/1270477542/telemetry.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/LCD_GFX.o ${OBJECTDIR}/ST7735.o ${OBJECTDIR}/main.o ${OBJECTDIR}/uart.o ${OBJECTDIR}/i2c.o ${OBJECTDIR}/max30102.o
+OBJECTFILES=${OBJECTDIR}/_ext/1270477542/LCD_GFX.o ${OBJECTDIR}/_ext/1270477542/ST7735.o ${OBJECTDIR}/main.o ${OBJECTDIR}/_ext/1270477542/uart.o ${OBJECTDIR}/_ext/1270477542/i2c.o ${OBJECTDIR}/_ext/1270477542/max30102.o ${OBJECTDIR}/_ext/1270477542/rng.o ${OBJECTDIR}/bench.o ${OBJECTDIR}/_ext/1270477542/telemetry.o
 
 # Source Files
-SOURCEFILES=LCD_GFX.c ST7735.c main.c uart.c i2c.c max30102.c
+SOURCEFILES=../common/LCD_GFX.c ../common/ST7735.c main.c ../common/uart.c ../common/i2c.c ../common/max30102.c ../common/rng.c bench.c ../common/telemetry.c
 
 
 
@@ -88,78 +88,114 @@ MP_PROCESSOR_OPTION=ATmega328PB
 # ------------------------------------------------------------------------------------
 # Rules for buildStep: compile
 ifeq ($(TYPE_IMAGE), DEBUG_RUN)
-${OBJECTDIR}/LCD_GFX.o: LCD_GFX.c  .generated_files/flags/default/7a2fa60978206d6cfafb8faed7fc29f0ee7a8516 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/LCD_GFX.o.d 
-	@${RM} ${OBJECTDIR}/LCD_GFX.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/LCD_GFX.o.d" -MT "${OBJECTDIR}/LCD_GFX.o.d" -MT ${OBJECTDIR}/LCD_GFX.o -o ${OBJECTDIR}/LCD_GFX.o LCD_GFX.c 
+${OBJECTDIR}/_ext/1270477542/LCD_GFX.o: ../common/LCD_GFX.c  .generated_files/flags/default/7a2fa60978206d6cfafb8faed7fc29f0ee7a8516 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d" -MT "${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d" -MT ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o -o ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o ../common/LCD_GFX.c 
 	
-${OBJECTDIR}/ST7735.o: ST7735.c  .generated_files/flags/default/19e92f87b4499f4653dbf82d5637cc6e1ef80a4f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/ST7735.o.d 
-	@${RM} ${OBJECTDIR}/ST7735.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/ST7735.o.d" -MT "${OBJECTDIR}/ST7735.o.d" -MT ${OBJECTDIR}/ST7735.o -o ${OBJECTDIR}/ST7735.o ST7735.c 
+${OBJECTDIR}/_ext/1270477542/ST7735.o: ../common/ST7735.c  .generated_files/flags/default/19e92f87b4499f4653dbf82d5637cc6e1ef80a4f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/ST7735.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/ST7735.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/ST7735.o.d" -MT "${OBJECTDIR}/_ext/1270477542/ST7735.o.d" -MT ${OBJECTDIR}/_ext/1270477542/ST7735.o -o ${OBJECTDIR}/_ext/1270477542/ST7735.o ../common/ST7735.c 
 	
 ${OBJECTDIR}/main.o: main.c  .generated_files/flags/default/40a24bf9363a1c405e599ea946d225bece436a9c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/main.o.d 
 	@${RM} ${OBJECTDIR}/main.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/main.o.d" -MT "${OBJECTDIR}/main.o.d" -MT ${OBJECTDIR}/main.o -o ${OBJECTDIR}/main.o main.c 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/main.o.d" -MT "${OBJECTDIR}/main.o.d" -MT ${OBJECTDIR}/main.o -o ${OBJECTDIR}/main.o main.c 
 	
-${OBJECTDIR}/uart.o: uart.c  .generated_files/flags/default/c54c63953cff864a3c32a045a8e3ecb49bb59a04 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/uart.o.d 
-	@${RM} ${OBJECTDIR}/uart.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/uart.o.d" -MT "${OBJECTDIR}/uart.o.d" -MT ${OBJECTDIR}/uart.o -o ${OBJECTDIR}/uart.o uart.c 
+${OBJECTDIR}/_ext/1270477542/uart.o: ../common/uart.c  .generated_files/flags/default/c54c63953cff864a3c32a045a8e3ecb49bb59a04 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/uart.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/uart.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/uart.o.d" -MT "${OBJECTDIR}/_ext/1270477542/uart.o.d" -MT ${OBJECTDIR}/_ext/1270477542/uart.o -o ${OBJECTDIR}/_ext/1270477542/uart.o ../common/uart.c 
 	
-${OBJECTDIR}/i2c.o: i2c.c  .generated_files/flags/default/61b505885068820ce8157dfb7939ff5a8235e74d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/i2c.o.d 
-	@${RM} ${OBJECTDIR}/i2c.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/i2c.o.d" -MT "${OBJECTDIR}/i2c.o.d" -MT ${OBJECTDIR}/i2c.o -o ${OBJECTDIR}/i2c.o i2c.c 
+${OBJECTDIR}/_ext/1270477542/i2c.o: ../common/i2c.c  .generated_files/flags/default/61b505885068820ce8157dfb7939ff5a8235e74d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/i2c.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/i2c.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/i2c.o.d" -MT "${OBJECTDIR}/_ext/1270477542/i2c.o.d" -MT ${OBJECTDIR}/_ext/1270477542/i2c.o -o ${OBJECTDIR}/_ext/1270477542/i2c.o ../common/i2c.c 
+	
+${OBJECTDIR}/_ext/1270477542/max30102.o: ../common/max30102.c  .generated_files/flags/default/edb05bb3961681eb5d523cf94ff1bbe3aa8a603b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/max30102.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/max30102.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/max30102.o.d" -MT "${OBJECTDIR}/_ext/1270477542/max30102.o.d" -MT ${OBJECTDIR}/_ext/1270477542/max30102.o -o ${OBJECTDIR}/_ext/1270477542/max30102.o ../common/max30102.c 
+	
+${OBJECTDIR}/_ext/1270477542/rng.o: ../common/rng.c  .generated_files/flags/default/552878c4b2a4fb0a0ca2998ce550e3611486ae19 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/rng.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/rng.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/rng.o.d" -MT "${OBJECTDIR}/_ext/1270477542/rng.o.d" -MT ${OBJECTDIR}/_ext/1270477542/rng.o -o ${OBJECTDIR}/_ext/1270477542/rng.o ../common/rng.c 
+	
+${OBJECTDIR}/_ext/1270477542/telemetry.o: ../common/telemetry.c  .generated_files/flags/default/709d0ec96e3ff70bc18590f54c0358bd410c5fd8 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/telemetry.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/telemetry.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/telemetry.o.d" -MT "${OBJECTDIR}/_ext/1270477542/telemetry.o.d" -MT ${OBJECTDIR}/_ext/1270477542/telemetry.o -o ${OBJECTDIR}/_ext/1270477542/telemetry.o ../common/telemetry.c 
 	
-${OBJECTDIR}/max30102.o: max30102.c  .generated_files/flags/default/edb05bb3961681eb5d523cf94ff1bbe3aa8a603b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/bench.o: bench.c  .generated_files/flags/default/acceb9a7702a80ceecc298aac937f2ceebac518c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/max30102.o.d 
-	@${RM} ${OBJECTDIR}/max30102.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/max30102.o.d" -MT "${OBJECTDIR}/max30102.o.d" -MT ${OBJECTDIR}/max30102.o -o ${OBJECTDIR}/max30102.o max30102.c 
+	@${RM} ${OBJECTDIR}/bench.o.d 
+	@${RM} ${OBJECTDIR}/bench.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/bench.o.d" -MT "${OBJECTDIR}/bench.o.d" -MT ${OBJECTDIR}/bench.o -o ${OBJECTDIR}/bench.o bench.c 
 	
 else
-${OBJECTDIR}/LCD_GFX.o: LCD_GFX.c  .generated_files/flags/default/e69915ce04403830082a464bb38e74c9d45572ad .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/LCD_GFX.o.d 
-	@${RM} ${OBJECTDIR}/LCD_GFX.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/LCD_GFX.o.d" -MT "${OBJECTDIR}/LCD_GFX.o.d" -MT ${OBJECTDIR}/LCD_GFX.o -o ${OBJECTDIR}/LCD_GFX.o LCD_GFX.c 
+${OBJECTDIR}/_ext/1270477542/LCD_GFX.o: ../common/LCD_GFX.c  .generated_files/flags/default/e69915ce04403830082a464bb38e74c9d45572ad .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d" -MT "${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d" -MT ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o -o ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o ../common/LCD_GFX.c 
 	
-${OBJECTDIR}/ST7735.o: ST7735.c  .generated_files/flags/default/e4792bb9b67ba76c0970cbd0eb6d7c415d772905 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/ST7735.o.d 
-	@${RM} ${OBJECTDIR}/ST7735.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/ST7735.o.d" -MT "${OBJECTDIR}/ST7735.o.d" -MT ${OBJECTDIR}/ST7735.o -o ${OBJECTDIR}/ST7735.o ST7735.c 
+${OBJECTDIR}/_ext/1270477542/ST7735.o: ../common/ST7735.c  .generated_files/flags/default/e4792bb9b67ba76c0970cbd0eb6d7c415d772905 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/ST7735.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/ST7735.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/ST7735.o.d" -MT "${OBJECTDIR}/_ext/1270477542/ST7735.o.d" -MT ${OBJECTDIR}/_ext/1270477542/ST7735.o -o ${OBJECTDIR}/_ext/1270477542/ST7735.o ../common/ST7735.c 
 	
 ${OBJECTDIR}/main.o: main.c  .generated_files/flags/default/bac93d3977cbaf947c08f947e274d3e4ca60727c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/main.o.d 
 	@${RM} ${OBJECTDIR}/main.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/main.o.d" -MT "${OBJECTDIR}/main.o.d" -MT ${OBJECTDIR}/main.o -o ${OBJECTDIR}/main.o main.c 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/main.o.d" -MT "${OBJECTDIR}/main.o.d" -MT ${OBJECTDIR}/main.o -o ${OBJECTDIR}/main.o main.c 
 	
-${OBJECTDIR}/uart.o: uart.c  .generated_files/flags/default/35691c72efeaa870a8dc96227f3a19da0f7d7c29 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/uart.o.d 
-	@${RM} ${OBJECTDIR}/uart.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/uart.o.d" -MT "${OBJECTDIR}/uart.o.d" -MT ${OBJECTDIR}/uart.o -o ${OBJECTDIR}/uart.o uart.c 
+${OBJECTDIR}/_ext/1270477542/uart.o: ../common/uart.c  .generated_files/flags/default/35691c72efeaa870a8dc96227f3a19da0f7d7c29 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/uart.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/uart.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/uart.o.d" -MT "${OBJECTDIR}/_ext/1270477542/uart.o.d" -MT ${OBJECTDIR}/_ext/1270477542/uart.o -o ${OBJECTDIR}/_ext/1270477542/uart.o ../common/uart.c 
 	
-${OBJECTDIR}/i2c.o: i2c.c  .generated_files/flags/default/9649a1ca5892444fa6e8cd05af9dc987ec617862 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/i2c.o.d 
-	@${RM} ${OBJECTDIR}/i2c.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/i2c.o.d" -MT "${OBJECTDIR}/i2c.o.d" -MT ${OBJECTDIR}/i2c.o -o ${OBJECTDIR}/i2c.o i2c.c 
+${OBJECTDIR}/_ext/1270477542/i2c.o: ../common/i2c.c  .generated_files/flags/default/9649a1ca5892444fa6e8cd05af9dc987ec617862 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/i2c.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/i2c.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/i2c.o.d" -MT "${OBJECTDIR}/_ext/1270477542/i2c.o.d" -MT ${OBJECTDIR}/_ext/1270477542/i2c.o -o ${OBJECTDIR}/_ext/1270477542/i2c.o ../common/i2c.c 
+	
+${OBJECTDIR}/_ext/1270477542/max30102.o: ../common/max30102.c  .generated_files/flags/default/737f018c1b51e69e510e0eac04185e2f80ddfb76 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/max30102.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/max30102.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/max30102.o.d" -MT "${OBJECTDIR}/_ext/1270477542/max30102.o.d" -MT ${OBJECTDIR}/_ext/1270477542/max30102.o -o ${OBJECTDIR}/_ext/1270477542/max30102.o ../common/max30102.c 
+	
+${OBJECTDIR}/_ext/1270477542/rng.o: ../common/rng.c  .generated_files/flags/default/85735ab6bdf3edfe33e7a7144ecbffbf8c86835f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/rng.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/rng.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/rng.o.d" -MT "${OBJECTDIR}/_ext/1270477542/rng.o.d" -MT ${OBJECTDIR}/_ext/1270477542/rng.o -o ${OBJECTDIR}/_ext/1270477542/rng.o ../common/rng.c 
+	
+${OBJECTDIR}/_ext/1270477542/telemetry.o: ../common/telemetry.c  .generated_files/flags/default/6f3f06238af4f288d249cd60f411e49c2d3b9fa2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/telemetry.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/telemetry.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/telemetry.o.d" -MT "${OBJECTDIR}/_ext/1270477542/telemetry.o.d" -MT ${OBJECTDIR}/_ext/1270477542/telemetry.o -o ${OBJECTDIR}/_ext/1270477542/telemetry.o ../common/telemetry.c 
 	
-${OBJECTDIR}/max30102.o: max30102.c  .generated_files/flags/default/737f018c1b51e69e510e0eac04185e2f80ddfb76 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/bench.o: bench.c  .generated_files/flags/default/2394db346526d62308bb5e4fa960a763e3db4970 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/max30102.o.d 
-	@${RM} ${OBJECTDIR}/max30102.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/max30102.o.d" -MT "${OBJECTDIR}/max30102.o.d" -MT ${OBJECTDIR}/max30102.o -o ${OBJECTDIR}/max30102.o max30102.c 
+	@${RM} ${OBJECTDIR}/bench.o.d 
+	@${RM} ${OBJECTDIR}/bench.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/bench.o.d" -MT "${OBJECTDIR}/bench.o.d" -MT ${OBJECTDIR}/bench.o -o ${OBJECTDIR}/bench.o bench.c 
 	
 endif
 
@@ -0,0 +1,31 @@
+/**
+ * @file project_config.h
+ * @brief Shared driver settings for the sensor bring-up tool
+ * @details Included first by common/drivers_config.h, anything left
+ *          undefined here takes the default from there
+ */
+
+#ifndef PROJECT_CONFIG_H
+#define PROJECT_CONFIG_H
+
+#define F_CPU 16000000UL
+
+// Every sample line matters here, wait for the UART instead of dropping
+#define UART_TX_OVERFLOW UART_TX_BLOCK
+
+// Nothing is queued behind the blocking FIFO reads
+#define I2C_QUEUE_SIZE 2
+
+// 1 replaces the sample loop with the driver and DSP benchmark in bench.c,
+// make bench in the top directory builds it
+#ifndef HRTEST_BENCHMARK
+#define HRTEST_BENCHMARK 0
+#endif
+
+// 1 also streams every raw sample as binary telemetry frames, see
+// telemetry.h, make capture in the top directory builds it
+#ifndef HRTEST_TELEMETRY
+#define HRTEST_TELEMETRY 0
+#endif
+
+#endif /* PROJECT_CONFIG_H */
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""
+png2sprite.py - convert PNG artwork into PROGMEM sprite tables for LCD_GFX
+
+Each PNG becomes a palette-indexed, run-length-encoded LCD_sprite_t that
+LCD_drawBitmapRLE() streams into one address window. The encoding is one
+byte per run: the high nibble is the run length minus one (1-16 pixels),
+the low nibble the palette index (up to 16 colors per sprite). Runs wrap
+across rows because the panel window is filled row by row.
+
+Only the Python standard library is used, the decoder handles the
+non-interlaced 8-bit RGB, RGBA, grayscale and palette PNGs an editor saves.
+
+Usage:
+    png2sprite.py -o reel_sprites name=art.png [name=art.png ...]
+
+Writes <out>.c and <out>.h. Fully transparent pixels take the color given
+with --background (RGB565 hex, default 0x001F, the reel blue).
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+
+def read_png(path):
+    """Decode a PNG into (width, height, rows of (r, g, b, a) tuples)."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: not a PNG file' % path)
+
+    pos = 8
+    idat = b''
+    palette = []
+    alpha = []
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'PLTE':
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b'tRNS':
+            alpha = list(body)
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+
+    if depth != 8 or interlace != 0:
+        raise ValueError('%s: only 8-bit non-interlaced PNGs are supported' % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        base = y * (stride + 1)
+        kind = raw[base]
+        line = bytearray(raw[base + 1:base + 1 + stride])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        prev = line
+
+        pixels = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color == 0:
+                pixels.append((px[0], px[0], px[0], 255))
+            elif color == 2:
+                pixels.append((px[0], px[1], px[2], 255))
+            elif color == 3:
+                r, g, b = palette[px[0]]
+                a = alpha[px[0]] if px[0] < len(alpha) else 255
+                pixels.append((r, g, b, a))
+            elif color == 4:
+                pixels.append((px[0], px[0], px[0], px[1]))
+            else:
+                pixels.append(tuple(px))
+        rows.append(pixels)
+
+    return width, height, rows
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def encode(width, height, rows, background):
+    """Return (palette, runs) for one sprite."""
+    palette = []
+    indices = []
+    for row in rows:
+        for r, g, b, a in row:
+            color = background if a < 128 else rgb565(r, g, b)
+            if color not in palette:
+                palette.append(color)
+            indices.append(palette.index(color))
+    if len(palette) > 16:
+        raise ValueError('sprite uses %d colors, at most 16 fit the nibble index' % len(palette))
+
+    runs = []
+    i = 0
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and run < 16 and indices[i + run] == indices[i]:
+            run += 1
+        runs.append(((run - 1) << 4) | indices[i])
+        i += run
+    return palette, runs
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert PNGs to RLE sprite tables')
+    parser.add_argument('-o', '--output', required=True, help='output base path, without extension')
+    parser.add_argument('--background', default='0x001F', help='RGB565 color for transparent pixels')
+    parser.add_argument('sprites', nargs='+', help='name=file.png')
+    args = parser.parse_args()
+
+    background = int(args.background, 0)
+    base = os.path.basename(args.output)
+    guard = base.upper() + '_H_'
+
+    command = ' * Regenerate with: png2sprite.py ' + ' '.join(sys.argv[1:])
+    header = ['/*', ' * %s.h' % base, ' *',
+              ' * Generated by tools/png2sprite.py, do not edit.', command, ' */', '',
+              '#ifndef %s' % guard, '#define %s' % guard, '',
+              '#include "LCD_GFX.h"', '']
+    source = ['/*', ' * %s.c' % base, ' *',
+              ' * Generated by tools/png2sprite.py, do not edit.', command, ' */', '',
+              '#include <avr/pgmspace.h>', '#include "%s.h"' % base, '']
+
+    total = 0
+    for spec in args.sprites:
+        name, _, path = spec.partition('=')
+        width, height, rows = read_png(path)
+        palette, runs = encode(width, height, rows, background)
+        total += 2 * len(palette) + len(runs) + 8
+
+        header.append('extern const LCD_sprite_t %s PROGMEM;  // %dx%d, %d colors, %d runs'
+                      % (name, width, height, len(palette), len(runs)))
+
+        source.append('// %s: %dx%d from %s' % (name, width, height, os.path.basename(path)))
+        source.append('static const uint16_t %s_palette[%d] PROGMEM = {' % (name, len(palette)))
+        source.append('    ' + ', '.join('0x%04X' % c for c in palette))
+        source.append('};')
+        source.append('')
+        source.append('static const uint8_t %s_runs[%d] PROGMEM = {' % (name, len(runs)))
+        for i in range(0, len(runs), 12):
+            source.append('    ' + ', '.join('0x%02X' % r for r in runs[i:i + 12]) + ',')
+        source.append('};')
+        source.append('')
+        source.append('const LCD_sprite_t %s PROGMEM = {' % name)
+        source.append('    %d, %d, %d, %s_palette, %s_runs, %d'
+                      % (width, height, len(palette), name, name, len(runs)))
+        source.append('};')
+        source.append('')
+
+    header += ['', '#endif /* %s */' % guard, '']
+
+    with open(args.output + '.h', 'w') as f:
+        f.write('\n'.join(header))
+    with open(args.output + '.c', 'w') as f:
+        f.write('\n'.join(source))
+
+    print('%d sprites, %d bytes of flash' % (len(args.sprites), total), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
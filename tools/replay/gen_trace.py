@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+"""
+gen_trace.py - synthesize a red/IR PPG trace for the replay harness
+
+The pulse model is a systolic peak plus a dicrotic bump, on top of a DC
+level, slow baseline wander (breathing) and white noise, sampled at 100 Hz
+like the firmware. The output starts with "# ref_bpm=" so replay picks up
+the reference on its own.
+
+Usage:
+    gen_trace.py --bpm 72 --seconds 30 > trace.csv
+"""
+
+import argparse
+import math
+import random
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0].strip())
+    parser.add_argument('--bpm', type=float, default=72)
+    parser.add_argument('--seconds', type=float, default=30)
+    parser.add_argument('--rate', type=int, default=100, help='samples per second')
+    parser.add_argument('--dc', type=int, default=100000, help='IR DC level in counts')
+    parser.add_argument('--pulse', type=float, default=1200, help='IR pulse depth in counts')
+    parser.add_argument('--wander', type=float, default=800, help='baseline wander in counts')
+    parser.add_argument('--noise', type=float, default=100, help='peak white noise in counts')
+    parser.add_argument('--spo2-ratio', type=float, default=0.6,
+                        help='red/IR perfusion ratio R, 0.6 is about 95%%')
+    parser.add_argument('--seed', type=int, default=1)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    red_dc = args.dc * 0.8
+    print('# ref_bpm=%g' % args.bpm)
+    print('# synthetic: %s' % ' '.join('%s=%s' % kv for kv in sorted(vars(args).items())))
+    for n in range(int(args.seconds * args.rate)):
+        t = n / args.rate
+        phase = (t * args.bpm / 60.0) % 1.0
+        pulse = (math.exp(-((phase - 0.2) / 0.08) ** 2)
+                 + 0.3 * math.exp(-((phase - 0.55) / 0.08) ** 2))
+        wander = args.wander * math.sin(2 * math.pi * 0.2 * t)
+        ir = args.dc + wander - args.pulse * pulse + rng.uniform(-args.noise, args.noise)
+        red_pulse = args.pulse * args.spo2_ratio * red_dc / args.dc
+        red = red_dc + wander * 0.8 - red_pulse * pulse + rng.uniform(-args.noise, args.noise)
+        print('%d,%d' % (max(0, min(0x3FFFF, round(red))), max(0, min(0x3FFFF, round(ir)))))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,185 @@
+/**
+ * @file hal_shim.c
+ * @brief Host model of the MAX30102 behind the i2c.h API
+ * @details Implements the i2c.h functions the sensor driver uses on top of a
+ *          256-byte register file. FIFO_WR_PTR, FIFO_RD_PTR and FIFO_OVF_CNT
+ *          follow the emulated FIFO, reads of FIFO_DATA pop its bytes without
+ *          advancing the register address, like the real part. Asynchronous
+ *          transactions complete immediately inside i2c_submit().
+ */
+
+#include "hal_shim.h"
+#include "i2c.h"
+#include "max30102.h"
+#include <string.h>
+
+volatile uint8_t EICRA, EIMSK, SREG;
+
+static uint8_t regs[256];
+static uint8_t fifo[MAX30102_FIFO_DEPTH][MAX30102_BYTES_PER_SAMPLE];
+static uint8_t fifo_wr, fifo_rd, fifo_used, fifo_byte, fifo_ovf;
+static uint32_t bus_bytes;
+static uint32_t noise = 0x2545F491;
+
+/**
+ * @brief Cheap xorshift noise for the don't-care sample bits
+ */
+static uint8_t shim_noise(void) {
+    noise ^= noise << 13;
+    noise ^= noise >> 17;
+    noise ^= noise << 5;
+    return (uint8_t)noise;
+}
+
+/**
+ * @brief Read one register the way the sensor would
+ */
+static uint8_t shim_read_reg(uint8_t reg) {
+    uint8_t value;
+
+    switch (reg) {
+        case MAX30102_FIFO_WR_PTR:
+            return fifo_wr;
+        case MAX30102_FIFO_RD_PTR:
+            return fifo_rd;
+        case MAX30102_FIFO_OVF_CNT:
+            return fifo_ovf;
+        case MAX30102_FIFO_DATA:
+            if (fifo_used == 0) {
+                return 0;
+            }
+            value = fifo[fifo_rd][fifo_byte];
+            if (++fifo_byte == MAX30102_BYTES_PER_SAMPLE) {
+                fifo_byte = 0;
+                fifo_rd = (fifo_rd + 1) % MAX30102_FIFO_DEPTH;
+                fifo_used--;
+                fifo_ovf = 0;
+            }
+            return value;
+        case MAX30102_INT_STATUS_1:
+            // Reading the status clears it, A_FULL follows the FIFO level
+            value = regs[reg];
+            regs[reg] = 0;
+            return value | ((fifo_used >= MAX30102_FIFO_DEPTH - 15) ? MAX30102_INT_A_FULL : 0);
+        default:
+            return regs[reg];
+    }
+}
+
+/**
+ * @brief Write one register, FIFO pointer writes clear the FIFO
+ */
+static void shim_write_reg(uint8_t reg, uint8_t value) {
+    switch (reg) {
+        case MAX30102_FIFO_WR_PTR:
+        case MAX30102_FIFO_RD_PTR:
+        case MAX30102_FIFO_OVF_CNT:
+            fifo_wr = fifo_rd = fifo_used = fifo_byte = fifo_ovf = 0;
+            break;
+        case MAX30102_MODE_CONFIG:
+            regs[reg] = value & ~MAX30102_MODE_RESET;   // Reset bit self-clears
+            break;
+        default:
+            regs[reg] = value;
+            break;
+    }
+}
+
+/**
+ * @brief Register access with the sensor's auto-increment rules
+ */
+static void shim_transfer(uint8_t reg, uint8_t *data, uint8_t len, bool read) {
+    bus_bytes += 2 + len;   // Device and register address, then data
+    while (len--) {
+        if (read) {
+            *data++ = shim_read_reg(reg);
+        } else {
+            shim_write_reg(reg, *data++);
+        }
+        if (reg != MAX30102_FIFO_DATA) {
+            reg++;
+        }
+    }
+}
+
+void shim_sensor_reset(void) {
+    memset(regs, 0, sizeof(regs));
+    regs[MAX30102_PART_ID] = 0x15;
+    regs[MAX30102_REV_ID] = 0x03;
+    fifo_wr = fifo_rd = fifo_used = fifo_byte = fifo_ovf = 0;
+    bus_bytes = 0;
+}
+
+bool shim_fifo_push(uint32_t red, uint32_t ir) {
+    uint8_t *slot = fifo[fifo_wr];
+    uint32_t r = (red & 0x3FFFF) | ((uint32_t)(shim_noise() & 0xFC) << 16);
+    uint32_t i = (ir & 0x3FFFF) | ((uint32_t)(shim_noise() & 0xFC) << 16);
+
+    if (fifo_used == MAX30102_FIFO_DEPTH) {
+        if (fifo_ovf < 0x1F) {
+            fifo_ovf++;
+        }
+        return false;
+    }
+
+    slot[0] = r >> 16; slot[1] = r >> 8; slot[2] = r;
+    slot[3] = i >> 16; slot[4] = i >> 8; slot[5] = i;
+    fifo_wr = (fifo_wr + 1) % MAX30102_FIFO_DEPTH;
+    fifo_used++;
+    return true;
+}
+
+uint8_t shim_fifo_count(void) {
+    return fifo_used;
+}
+
+uint32_t shim_bus_bytes(void) {
+    return bus_bytes;
+}
+
+/* i2c.h, register-level functions used by max30102.c */
+
+void i2c_init(uint32_t frequency) {
+    (void)frequency;
+}
+
+bool i2c_write_register(uint8_t dev_addr, uint8_t reg_addr, uint8_t data) {
+    if (dev_addr != MAX30102_I2C_ADDR) {
+        return false;
+    }
+    shim_transfer(reg_addr, &data, 1, false);
+    return true;
+}
+
+bool i2c_read_register(uint8_t dev_addr, uint8_t reg_addr, uint8_t *data) {
+    return i2c_read_registers(dev_addr, reg_addr, data, 1);
+}
+
+bool i2c_read_registers(uint8_t dev_addr, uint8_t reg_addr, uint8_t *data, uint8_t len) {
+    if (dev_addr != MAX30102_I2C_ADDR) {
+        return false;
+    }
+    shim_transfer(reg_addr, data, len, true);
+    return true;
+}
+
+bool i2c_is_device_ready(uint8_t address) {
+    return address == MAX30102_I2C_ADDR;
+}
+
+bool i2c_submit(i2c_transaction_t *txn) {
+    bool ok = (txn->dev_addr == MAX30102_I2C_ADDR);
+
+    if (ok) {
+        shim_transfer(txn->reg_addr, txn->data, txn->len, txn->read);
+    }
+    txn->status = ok ? I2C_TXN_DONE : I2C_TXN_ERROR;
+    if (txn->callback) {
+        txn->callback(ok, txn->context);
+    }
+    return true;
+}
+
+bool i2c_async_busy(void) {
+    return false;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file hal_shim.h
+ * @brief Host model of the MAX30102 behind the i2c.h API
+ * @details The driver talks to a register file and a 32-sample FIFO instead
+ *          of the TWI peripheral. The replay harness fills the FIFO with
+ *          recorded samples, the driver reads them back through its normal
+ *          register and FIFO_DATA paths.
+ */
+
+#ifndef HAL_SHIM_H
+#define HAL_SHIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Clear the register file and the FIFO, set the part and revision IDs
+ * @return none
+ */
+void shim_sensor_reset(void);
+
+/**
+ * @brief Queue one sample in the emulated FIFO as the sensor would encode it
+ * @param red Red channel, 18 bits
+ * @param ir IR channel, 18 bits
+ * @return false if the FIFO is full, the sample is then counted as overflow
+ * @note The don't-care bits above bit 17 are filled with noise so the
+ *       driver's masking is exercised
+ */
+bool shim_fifo_push(uint32_t red, uint32_t ir);
+
+/**
+ * @brief Number of samples waiting in the emulated FIFO
+ * @return sample count, 0 to 32
+ */
+uint8_t shim_fifo_count(void);
+
+/**
+ * @brief Total bytes moved over the emulated bus since the last reset
+ * @return byte count, register address bytes included
+ */
+uint32_t shim_bus_bytes(void);
+
+#endif // HAL_SHIM_H
@@ -0,0 +1,13 @@
+/**
+ * @file project_config.h
+ * @brief Shared driver settings for the host replay build
+ * @details Included first by common/drivers_config.h. F_CPU only matters
+ *          to the register shims, the defaults cover the rest.
+ */
+
+#ifndef PROJECT_CONFIG_H
+#define PROJECT_CONFIG_H
+
+#define F_CPU 16000000UL
+
+#endif /* PROJECT_CONFIG_H */
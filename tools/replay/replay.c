@@ -0,0 +1,331 @@
+/**
+ * @file replay.c
+ * @brief Replay recorded red/IR traces through the MAX30102 driver on the host
+ * @details Each trace is pushed into the emulated sensor FIFO in batches,
+ *          drained into the sample ring with max30102_stream_drain() and
+ *          handed to max30102_calculate_hr_spo2(), the same path the
+ *          firmware uses.
+ *          The reported heart rate is compared against the reference BPM and
+ *          every batch is timed.
+ *
+ *          Columns: time to the first stable reading and its BPM, which is
+ *          what the game acts on, last valid BPM, mean
+ *          absolute error of stable readings (MAE), share of scored batches
+ *          with a stable reading within --tolerance (hit%), mean absolute
+ *          error of every valid reading (rawMAE), then time per batch.
+ *
+ *          Trace files are text with one sample per line:
+ *              red,ir                  (gen_trace.py, any separator)
+ *              frame,sample,red,ir     (tools/telemetry_decode.py output of
+ *                                       a make capture build of hrtest.X or
+ *                                       of ttslots.X with TELEMETRY_ENABLE)
+ *              red<TAB>ir<TAB>...      (hrtest.X text log, decimated to one
+ *                                       sample per batch, so only a smoke test)
+ *          Lines that do not start with a number are ignored. A comment line
+ *          "# ref_bpm=72" sets the reference unless --ref is given.
+ *
+ *          Timing is host time and, on x86, TSC cycles. It ranks DSP variants
+ *          against each other, absolute AVR cycle counts need the target.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include "max30102.h"
+#include "hal_shim.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_CYCLES() __rdtsc()
+#else
+#define HOST_CYCLES() 0ULL
+#endif
+
+#define REPLAY_MAX_BATCH    MAX30102_FIFO_DEPTH
+#define DEFAULT_BATCH       10
+#define DEFAULT_SETTLE_S    5       // Seconds ignored before scoring
+#define SAMPLE_RATE_HZ      100
+
+typedef struct {
+    uint32_t *red;
+    uint32_t *ir;
+    size_t count;
+    double ref_bpm;         // 0 if the trace has no reference
+} trace_t;
+
+typedef struct {
+    size_t batches;
+    size_t scored;          // Batches after the settle time
+    size_t valid;           // Scored batches with a valid heart rate
+    size_t stable;          // Scored batches with a stable heart rate
+    size_t within;          // Stable batches within the tolerance
+    double valid_error;     // Absolute error summed over valid batches
+    double stable_error;    // Absolute error summed over stable batches
+    double first_stable_s;  // -1 if never stable
+    double first_stable_bpm;
+    double last_bpm;
+    double ns_total, ns_max;
+    unsigned long long cycles_total, cycles_max;
+    uint32_t bus_bytes;
+} replay_stats_t;
+
+static int batch_size = DEFAULT_BATCH;
+static double settle_s = DEFAULT_SETTLE_S;
+static double ref_override = 0;
+static double tolerance = 5;
+static double max_error = 0;
+static double max_lock = 0;
+
+/**
+ * @brief Parse a trace file into red/IR arrays
+ * @return true on success, false if the file could not be read or is empty
+ */
+static bool load_trace(const char *path, trace_t *trace) {
+    FILE *f = fopen(path, "r");
+    char line[256];
+    size_t capacity = 0;
+    int column = 0;     // Index of the red value on a line
+
+    memset(trace, 0, sizeof(*trace));
+    if (!f) {
+        perror(path);
+        return false;
+    }
+
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long values[4];
+        int n = 0;
+        char *p = line;
+
+        if (line[0] == '#') {
+            char *ref = strstr(line, "ref_bpm=");
+            if (ref) {
+                trace->ref_bpm = atof(ref + 8);
+            }
+            continue;
+        }
+        if (strncmp(line, "frame,sample,red,ir", 19) == 0) {
+            column = 2;
+            continue;
+        }
+        while (n < 4) {
+            char *end;
+            while (*p && !isdigit((unsigned char)*p) && *p != '\n') {
+                if (n == 0 && !isspace((unsigned char)*p)) {
+                    break;      // Text line, skip
+                }
+                p++;
+            }
+            values[n] = strtoul(p, &end, 10);
+            if (end == p) {
+                break;
+            }
+            n++;
+            p = end;
+            while (*p == ',' || *p == '\t' || *p == ' ' || *p == ';') {
+                p++;
+            }
+        }
+        if (n < column + 2) {
+            continue;
+        }
+
+        if (trace->count == capacity) {
+            capacity = capacity ? capacity * 2 : 4096;
+            trace->red = realloc(trace->red, capacity * sizeof(uint32_t));
+            trace->ir = realloc(trace->ir, capacity * sizeof(uint32_t));
+            if (!trace->red || !trace->ir) {
+                fclose(f);
+                return false;
+            }
+        }
+        trace->red[trace->count] = values[column];
+        trace->ir[trace->count] = values[column + 1];
+        trace->count++;
+    }
+    fclose(f);
+
+    if (ref_override > 0) {
+        trace->ref_bpm = ref_override;
+    }
+    return trace->count > 0;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief Run one trace through the driver
+ */
+static void replay_trace(const trace_t *trace, replay_stats_t *stats) {
+    max30102_fifo_sample_t samples[REPLAY_MAX_BATCH];
+    max30102_result_t result;
+    size_t pos = 0;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->first_stable_s = -1;
+    shim_sensor_reset();
+    max30102_stream_reset();
+    max30102_hr_reset();
+    // Recorded levels do not follow the LED current, keep the AGC out of it
+    max30102_agc_enable(false);
+    memset(&result, 0, sizeof(result));
+
+    while (pos < trace->count) {
+        uint8_t count = 0;
+        double t0, ns;
+        unsigned long long c0, cycles;
+
+        while (count < batch_size && pos < trace->count) {
+            shim_fifo_push(trace->red[pos], trace->ir[pos]);
+            pos++;
+            count++;
+        }
+
+        t0 = now_ns();
+        c0 = HOST_CYCLES();
+        // Through the ring like the firmware's sensor task
+        max30102_stream_drain();
+        count = 0;
+        while (count < batch_size && max30102_stream_pop(&samples[count])) {
+            count++;
+        }
+        max30102_calculate_hr_spo2(samples, count, &result);
+        cycles = HOST_CYCLES() - c0;
+        ns = now_ns() - t0;
+
+        stats->batches++;
+        stats->ns_total += ns;
+        stats->cycles_total += cycles;
+        if (ns > stats->ns_max) stats->ns_max = ns;
+        if (cycles > stats->cycles_max) stats->cycles_max = cycles;
+
+        double t = (double)pos / SAMPLE_RATE_HZ;
+        if (result.hr_stable && stats->first_stable_s < 0) {
+            stats->first_stable_s = t;
+            stats->first_stable_bpm = result.heart_rate;
+        }
+        if (result.hr_valid) {
+            stats->last_bpm = result.heart_rate;
+        }
+        if (t < settle_s) {
+            continue;
+        }
+        stats->scored++;
+        if (result.hr_valid && trace->ref_bpm > 0) {
+            double err = result.heart_rate - trace->ref_bpm;
+            if (err < 0) err = -err;
+            stats->valid++;
+            stats->valid_error += err;
+            // The game only acts on stable readings, score those separately
+            if (result.hr_stable) {
+                stats->stable++;
+                stats->stable_error += err;
+                if (err <= tolerance) stats->within++;
+            }
+        }
+    }
+    stats->bus_bytes = shim_bus_bytes();
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [--batch N] [--ref BPM] [--settle S] [--tolerance BPM]\n"
+            "          [--max-error BPM] [--max-lock S] trace...\n"
+            "  --batch N        samples per driver call, 1..%d (default %d)\n"
+            "  --ref BPM        reference heart rate, overrides # ref_bpm=\n"
+            "  --settle S       seconds before scoring starts (default %d)\n"
+            "  --tolerance BPM  error counted as a hit (default 5)\n"
+            "  --max-error BPM  exit 1 if any trace has a larger stable MAE\n"
+            "                   or never becomes stable\n"
+            "  --max-lock S     exit 1 if any trace takes longer to become\n"
+            "                   stable, or its first stable reading is off by\n"
+            "                   more than --tolerance\n",
+            prog, REPLAY_MAX_BATCH, DEFAULT_BATCH, DEFAULT_SETTLE_S);
+}
+
+int main(int argc, char **argv) {
+    int failed = 0;
+    int traces = 0;
+    int i;
+
+    for (i = 1; i < argc && strncmp(argv[i], "--", 2) == 0; i++) {
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 2;
+        }
+        if (strcmp(argv[i], "--batch") == 0) {
+            batch_size = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ref") == 0) {
+            ref_override = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--settle") == 0) {
+            settle_s = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--tolerance") == 0) {
+            tolerance = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--max-error") == 0) {
+            max_error = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--max-lock") == 0) {
+            max_lock = atof(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (i >= argc || batch_size < 1 || batch_size > REPLAY_MAX_BATCH) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    printf("%-24s %7s %6s %7s %6s %6s %6s %6s %7s %9s %10s %10s\n",
+           "trace", "samples", "ref", "stable", "first", "last", "MAE", "hit%", "rawMAE",
+           "ns/batch", "cyc/batch", "cyc max");
+    for (; i < argc; i++) {
+        trace_t trace;
+        replay_stats_t stats;
+        const char *name = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i];
+        double mae = -1, raw_mae = -1;
+
+        if (!load_trace(argv[i], &trace)) {
+            fprintf(stderr, "%s: no samples\n", argv[i]);
+            failed = 1;
+            continue;
+        }
+        replay_trace(&trace, &stats);
+        traces++;
+
+        if (stats.stable > 0) {
+            mae = stats.stable_error / stats.stable;
+        }
+        if (stats.valid > 0) {
+            raw_mae = stats.valid_error / stats.valid;
+        }
+        printf("%-24s %7zu %6.1f %6.1fs %6.0f %6.0f %6.1f %5.0f%% %7.1f %9.0f %10llu %10llu\n",
+               name, trace.count, trace.ref_bpm, stats.first_stable_s,
+               stats.first_stable_bpm, stats.last_bpm, mae,
+               stats.scored ? 100.0 * stats.within / stats.scored : 0.0, raw_mae,
+               stats.ns_total / stats.batches,
+               stats.cycles_total / stats.batches, stats.cycles_max);
+
+        if (max_error > 0 && (mae < 0 || mae > max_error)) {
+            failed = 1;
+        }
+        if (max_lock > 0) {
+            double first_error = stats.first_stable_bpm - trace.ref_bpm;
+            if (first_error < 0) first_error = -first_error;
+            if (stats.first_stable_s < 0 || stats.first_stable_s > max_lock ||
+                (trace.ref_bpm > 0 && first_error > tolerance)) {
+                failed = 1;
+            }
+        }
+        free(trace.red);
+        free(trace.ir);
+    }
+
+    return (failed || traces == 0) ? 1 : 0;
+}
@@ -0,0 +1,11 @@
+/*
+ * avr/interrupt.h - host stand-in, interrupts do not exist on the host
+ */
+#ifndef REPLAY_SHIM_AVR_INTERRUPT_H
+#define REPLAY_SHIM_AVR_INTERRUPT_H
+
+#define ISR(vector, ...)    void vector(void)
+#define sei()
+#define cli()
+
+#endif
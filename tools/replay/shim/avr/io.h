@@ -0,0 +1,19 @@
+/*
+ * avr/io.h - host stand-in with the few ATmega328PB registers the sensor
+ * driver touches. They are plain variables defined in hal_shim.c.
+ */
+#ifndef REPLAY_SHIM_AVR_IO_H
+#define REPLAY_SHIM_AVR_IO_H
+
+#include <stdint.h>
+
+extern volatile uint8_t EICRA, EIMSK, SREG;
+
+#define ISC00   0
+#define ISC01   1
+#define ISC10   2
+#define ISC11   3
+#define INT0    0
+#define INT1    1
+
+#endif
@@ -0,0 +1,16 @@
+/*
+ * avr/pgmspace.h - host stand-in, flash and RAM share one address space
+ */
+#ifndef REPLAY_SHIM_AVR_PGMSPACE_H
+#define REPLAY_SHIM_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s)                 (s)
+#define pgm_read_byte(addr)     (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)     (*(const uint16_t *)(addr))
+#define memcpy_P                memcpy
+
+#endif
@@ -0,0 +1,10 @@
+/*
+ * util/delay.h - host stand-in, delays return immediately
+ */
+#ifndef REPLAY_SHIM_UTIL_DELAY_H
+#define REPLAY_SHIM_UTIL_DELAY_H
+
+#define _delay_ms(ms)   ((void)(ms))
+#define _delay_us(us)   ((void)(us))
+
+#endif
@@ -0,0 +1,9 @@
+/*
+ * xc.h - host stand-in for the XC8 device header, see tools/replay
+ */
+#ifndef REPLAY_SHIM_XC_H
+#define REPLAY_SHIM_XC_H
+
+#include <avr/io.h>
+
+#endif
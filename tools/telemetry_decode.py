@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""
+telemetry_decode.py - decode the binary sample stream from common/telemetry.c
+
+Reads a raw UART capture (file, '-' for stdin, or a serial port with
+--port, which needs pyserial) and writes one CSV line per sample:
+
+    frame,sample,red,ir
+
+Frames start with 0xA5 and are validated with their CRC-16/CCITT-FALSE, so
+text log output interleaved with the frames is skipped. Sequence gaps
+(frames dropped on the device because the UART buffer was full) and CRC
+failures are reported on stderr.
+
+Usage:
+    telemetry_decode.py capture.bin > samples.csv
+    telemetry_decode.py --port /dev/ttyUSB0 --baud 9600 > samples.csv
+"""
+
+import argparse
+import binascii
+import sys
+
+SYNC = 0xA5
+MAX_SAMPLES = 10
+
+
+def payload_size(count):
+    return (count * 36 + 7) // 8
+
+
+def unpack_samples(payload, count):
+    """Split the MSB-first bit stream into count (red, ir) pairs."""
+    bits = int.from_bytes(payload, 'big')
+    total = len(payload) * 8
+    values = []
+    for i in range(count * 2):
+        shift = total - 18 * (i + 1)
+        values.append((bits >> shift) & 0x3FFFF)
+    return list(zip(values[0::2], values[1::2]))
+
+
+class Decoder:
+    """Incremental frame decoder, feed() it bytes in any chunk size."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.last_seq = None
+        self.frames = 0
+        self.lost = 0
+        self.crc_errors = 0
+
+    def feed(self, data):
+        """Yield (seq, [(red, ir), ...]) for every valid frame in data."""
+        self.buffer.extend(data)
+        while True:
+            start = self.buffer.find(bytes([SYNC]))
+            if start < 0:
+                self.buffer.clear()
+                return
+            del self.buffer[:start]
+            if len(self.buffer) < 3:
+                return
+            count = self.buffer[2]
+            if count == 0 or count > MAX_SAMPLES:
+                del self.buffer[0]      # Not a frame header, resync
+                continue
+            length = 3 + payload_size(count) + 2
+            if len(self.buffer) < length:
+                return
+            frame = bytes(self.buffer[:length])
+            crc = int.from_bytes(frame[-2:], 'big')
+            if binascii.crc_hqx(frame[1:-2], 0xFFFF) != crc:
+                self.crc_errors += 1
+                del self.buffer[0]
+                continue
+            del self.buffer[:length]
+
+            seq = frame[1]
+            if self.last_seq is not None:
+                gap = (seq - self.last_seq - 1) & 0xFF
+                if gap:
+                    self.lost += gap
+                    print('frame %d: %d frame(s) lost' % (seq, gap), file=sys.stderr)
+            self.last_seq = seq
+            self.frames += 1
+            yield seq, unpack_samples(frame[3:-2], count)
+
+
+def open_input(args):
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            sys.exit('--port needs pyserial (pip install pyserial)')
+        port = serial.Serial(args.port, args.baud, stopbits=serial.STOPBITS_TWO, timeout=1)
+        return lambda: port.read(256)
+    stream = sys.stdin.buffer if args.input == '-' else open(args.input, 'rb')
+    return lambda: stream.read(4096)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0].strip())
+    parser.add_argument('input', nargs='?', default='-', help="raw capture, '-' for stdin")
+    parser.add_argument('--port', help='read from a serial port instead')
+    parser.add_argument('--baud', type=int, default=9600)
+    args = parser.parse_args()
+
+    read = open_input(args)
+    decoder = Decoder()
+    print('frame,sample,red,ir')
+    try:
+        while True:
+            data = read()
+            if not data:
+                if not args.port:
+                    break
+                continue
+            for _, samples in decoder.feed(data):
+                # Lost frames keep their number so gaps stay visible in the CSV
+                frame = decoder.frames + decoder.lost - 1
+                for i, (red, ir) in enumerate(samples):
+                    print('%d,%d,%d,%d' % (frame, i, red, ir))
+    except KeyboardInterrupt:
+        pass
+
+    print('%d frames, %d lost, %d CRC errors'
+          % (decoder.frames, decoder.lost, decoder.crc_errors), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
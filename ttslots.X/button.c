@@ -0,0 +1,115 @@
+/**
+ * @file button.c
+ * @brief Timer-sampled push button debouncer implementation
+ * @details Timer2 runs in CTC mode for the scheduler tick, so OCR2B below
+ *          OCR2A gives a second match once per millisecond. The ISR only reads
+ *          the pin and updates a few counters. The event queue has a single
+ *          producer (the ISR) and a single consumer (main context), so it
+ *          needs no locking.
+ */
+#include "button.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#if (BUTTON_QUEUE_SIZE & (BUTTON_QUEUE_SIZE - 1)) != 0
+#error "BUTTON_QUEUE_SIZE must be a power of two"
+#endif
+
+#define BUTTON_QUEUE_MASK   (BUTTON_QUEUE_SIZE - 1)
+
+// Debouncer state, owned by the Timer2 compare B ISR
+static volatile bool pressed = false;       // Debounced level
+static uint8_t stable_ms = 0;               // Time the raw level disagreed
+static uint16_t held_ms = 0;                // Time since the press edge
+
+// Event queue, written by the ISR and read in main context
+static volatile uint8_t events[BUTTON_QUEUE_SIZE];
+static volatile uint8_t event_head = 0;
+static volatile uint8_t event_tail = 0;
+
+static void button_post(button_event_t event);
+
+/**
+ * @brief Configure the button pin and start sampling
+ */
+void button_init(void) {
+    // Input with pull-up
+    BUTTON_DDR &= ~(1 << BUTTON_PIN);
+    BUTTON_PORT |= (1 << BUTTON_PIN);
+
+    // Sample halfway between scheduler ticks
+    OCR2B = OCR2A / 2;
+    TIFR2 = (1 << OCF2B);
+    TIMSK2 |= (1 << OCIE2B);
+}
+
+/**
+ * @brief Take the oldest pending event
+ * @return event, or BUTTON_EVENT_NONE if the queue is empty
+ */
+button_event_t button_get_event(void) {
+    button_event_t event;
+    uint8_t tail = event_tail;
+
+    if (tail == event_head) {
+        return BUTTON_EVENT_NONE;
+    }
+    event = (button_event_t)events[tail];
+    event_tail = (tail + 1) & BUTTON_QUEUE_MASK;
+    return event;
+}
+
+/**
+ * @brief Discard all pending events
+ */
+void button_flush(void) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        event_tail = event_head;
+    }
+}
+
+/**
+ * @brief Current debounced level
+ * @return true while the button is held down
+ */
+bool button_is_pressed(void) {
+    return pressed;
+}
+
+/**
+ * @brief Queue an event, dropped if the queue is full
+ * @param event Event to post
+ * @note Called from the Timer2 compare B ISR
+ */
+static void button_post(button_event_t event) {
+    uint8_t head = event_head;
+    uint8_t next = (head + 1) & BUTTON_QUEUE_MASK;
+
+    if (next != event_tail) {
+        events[head] = (uint8_t)event;
+        event_head = next;
+    }
+}
+
+/**
+ * @brief Timer2 compare match B: sample the button once per millisecond
+ */
+ISR(TIMER2_COMPB_vect) {
+    bool down = !(BUTTON_PINREG & (1 << BUTTON_PIN));
+
+    if (down == pressed) {
+        // Level agrees with the debounced state, bounces restart the count
+        stable_ms = 0;
+        if (pressed && held_ms < BUTTON_LONG_PRESS_MS) {
+            if (++held_ms == BUTTON_LONG_PRESS_MS) {
+                button_post(BUTTON_EVENT_LONG_PRESS);
+            }
+        }
+    } else if (++stable_ms >= BUTTON_DEBOUNCE_MS) {
+        stable_ms = 0;
+        pressed = down;
+        held_ms = 0;
+        button_post(down ? BUTTON_EVENT_PRESS : BUTTON_EVENT_RELEASE);
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file button.h
+ * @brief Timer-sampled push button debouncer for ATMEGA328PB
+ * @details The button level is sampled every millisecond from the Timer2
+ *          compare B interrupt, which shares the scheduler's 1 ms period. A
+ *          level has to hold for BUTTON_DEBOUNCE_MS before it is accepted,
+ *          and each accepted edge is posted to a small event queue that the
+ *          main loop drains with button_get_event().
+ */
+
+#ifndef BUTTON_H
+#define BUTTON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Button between PD2 and ground, internal pull-up, low when pressed
+#define BUTTON_DDR      DDRD
+#define BUTTON_PORT     PORTD
+#define BUTTON_PINREG   PIND
+#define BUTTON_PIN      PD2
+
+// Time a new level must be stable before it is accepted
+#define BUTTON_DEBOUNCE_MS      16
+
+// Hold time after which a press also reports BUTTON_EVENT_LONG_PRESS
+#define BUTTON_LONG_PRESS_MS    1000
+
+// Pending events, a power of two. Events beyond that are dropped.
+#define BUTTON_QUEUE_SIZE       4
+
+// Debounced button events
+typedef enum {
+    BUTTON_EVENT_NONE = 0,
+    BUTTON_EVENT_PRESS,         // Button went down
+    BUTTON_EVENT_RELEASE,       // Button came up
+    BUTTON_EVENT_LONG_PRESS     // Held for BUTTON_LONG_PRESS_MS, before release
+} button_event_t;
+
+/**
+ * @brief Configure the button pin and start sampling
+ * @return none
+ * @note Call after scheduler_init(), which starts Timer2 and owns TIMSK2
+ */
+void button_init(void);
+
+/**
+ * @brief Take the oldest pending event
+ * @return event, or BUTTON_EVENT_NONE if the queue is empty
+ */
+button_event_t button_get_event(void);
+
+/**
+ * @brief Discard all pending events
+ * @return none
+ */
+void button_flush(void);
+
+/**
+ * @brief Current debounced level
+ * @return true while the button is held down
+ */
+bool button_is_pressed(void);
+
+#endif /* BUTTON_H */
@@ -0,0 +1,167 @@
+/**
+ * @file buzzer.c
+ * @brief Interrupt-driven buzzer note sequencer implementation for ATMEGA328PB
+ * @details Timer3 is clocked at F_CPU/8. For a tone the compare match fires at
+ *          twice the note frequency and toggles the pin. For a rest it fires
+ *          every millisecond without touching the pin. The ISR counts down the
+ *          matches left in the note and loads the next note from flash.
+ */
+#include "drivers_config.h"
+#include "buzzer.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <stddef.h>
+
+#define BUZZER_TIMER_HZ     (F_CPU / 8)             // Timer3 clock
+#define BUZZER_REST_TOP     (BUZZER_TIMER_HZ / 1000 - 1)  // 1 ms per match
+
+// Private function prototypes
+static void buzzer_start_note(uint16_t freq_hz, uint16_t duration_ms);
+static void buzzer_next_note(void);
+static void buzzer_silence(void);
+
+// Playback state, shared with the Timer3 ISR
+static const buzzer_note_t *melody_ptr;     // Next note in flash
+static volatile uint8_t notes_left = 0;     // Notes after the current one
+static volatile uint32_t matches_left = 0;  // Compare matches left in current note
+static volatile bool tone_on = false;       // Toggle pin on compare match
+static volatile bool playing = false;
+
+/**
+ * @brief Initialize the buzzer pin and Timer3
+ */
+void buzzer_init(void) {
+    // Set buzzer pin as output, idle low
+    BUZZER_DDR |= (1 << BUZZER_PIN);
+    BUZZER_PORT &= ~(1 << BUZZER_PIN);
+    
+    // Timer3 in CTC mode (TOP = OCR3A), stopped until a note starts
+    TCCR3A = 0;
+    TCCR3B = (1 << WGM32);
+    TIMSK3 = 0;
+}
+
+/**
+ * @brief Load a note into Timer3 and start counting it down
+ * @param freq_hz Tone frequency in Hz, BUZZER_REST for silence
+ * @param duration_ms Note length in milliseconds
+ * @note Called with interrupts disabled or from the Timer3 ISR
+ */
+static void buzzer_start_note(uint16_t freq_hz, uint16_t duration_ms) {
+    uint16_t top;
+    
+    if (freq_hz < BUZZER_MIN_HZ) {
+        // Rest: one match per millisecond, pin stays low
+        tone_on = false;
+        BUZZER_PORT &= ~(1 << BUZZER_PIN);
+        top = BUZZER_REST_TOP;
+        matches_left = duration_ms;
+    } else {
+        // Tone: two matches (one toggle each) per period
+        tone_on = true;
+        top = (uint16_t)(BUZZER_TIMER_HZ / 2 / freq_hz) - 1;
+        matches_left = ((uint32_t)freq_hz * duration_ms) / 500;
+    }
+    
+    if (matches_left == 0) {
+        matches_left = 1;
+    }
+    
+    // Restart the count so a smaller TOP cannot be skipped past
+    OCR3A = top;
+    TCNT3 = 0;
+    TIFR3 = (1 << OCF3A);
+    TIMSK3 = (1 << OCIE3A);
+    TCCR3B = (1 << WGM32) | (1 << CS31);    // clk/8
+    playing = true;
+}
+
+/**
+ * @brief Advance to the next note of the melody or stop at the end
+ * @note Called from the Timer3 ISR
+ */
+static void buzzer_next_note(void) {
+    if (notes_left == 0) {
+        buzzer_silence();
+        return;
+    }
+    
+    notes_left--;
+    uint16_t freq_hz = pgm_read_word(&melody_ptr->freq_hz);
+    uint16_t duration_ms = pgm_read_word(&melody_ptr->duration_ms);
+    melody_ptr++;
+    buzzer_start_note(freq_hz, duration_ms);
+}
+
+/**
+ * @brief Stop Timer3 and drive the buzzer pin low
+ */
+static void buzzer_silence(void) {
+    TCCR3B = (1 << WGM32);      // No clock source, timer stopped
+    TIMSK3 = 0;
+    BUZZER_PORT &= ~(1 << BUZZER_PIN);
+    tone_on = false;
+    notes_left = 0;
+    matches_left = 0;
+    playing = false;
+}
+
+/**
+ * @brief Start playing a melody in the background
+ * @param melody Pointer to a PROGMEM array of notes
+ * @param length Number of notes in the melody
+ */
+void buzzer_play(const buzzer_note_t *melody, uint8_t length) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if (melody == NULL || length == 0) {
+            buzzer_silence();
+        } else {
+            melody_ptr = melody;
+            notes_left = length;
+            buzzer_next_note();
+        }
+    }
+}
+
+/**
+ * @brief Play a single tone in the background
+ * @param freq_hz Tone frequency in Hz
+ * @param duration_ms Tone length in milliseconds
+ */
+void buzzer_tone(uint16_t freq_hz, uint16_t duration_ms) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        notes_left = 0;
+        buzzer_start_note(freq_hz, duration_ms);
+    }
+}
+
+/**
+ * @brief Stop playback and silence the buzzer
+ */
+void buzzer_stop(void) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        buzzer_silence();
+    }
+}
+
+/**
+ * @brief Check whether a melody or tone is still playing
+ * @return true while playing, false when idle
+ */
+bool buzzer_is_playing(void) {
+    return playing;
+}
+
+/**
+ * @brief Timer3 compare match: toggle the pin and count down the note
+ */
+ISR(TIMER3_COMPA_vect) {
+    if (tone_on) {
+        BUZZER_PORT ^= (1 << BUZZER_PIN);
+    }
+    
+    if (--matches_left == 0) {
+        buzzer_next_note();
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * @file buzzer.h
+ * @brief Interrupt-driven buzzer note sequencer for ATMEGA328PB
+ * @details Melodies are tables of (frequency, duration) notes stored in flash.
+ *          Timer3 runs in CTC mode and its compare ISR toggles the buzzer pin,
+ *          so a melody plays in the background while the main loop keeps going.
+ */
+
+#ifndef BUZZER_H
+#define BUZZER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <avr/pgmspace.h>
+
+// Buzzer connected to PD5. OC0B is taken by Timer0, which is busy with the
+// backlight PWM on OC0A, so the pin is toggled from the Timer3 compare ISR.
+#define BUZZER_DDR      DDRD
+#define BUZZER_PORT     PORTD
+#define BUZZER_PIN      PD5
+
+// Frequency value used for a silent gap between notes
+#define BUZZER_REST     0
+
+// Lowest frequency Timer3 can produce with the /8 prescaler
+#define BUZZER_MIN_HZ   16
+
+// One note of a melody
+typedef struct {
+    uint16_t freq_hz;       // Tone frequency in Hz, BUZZER_REST for silence
+    uint16_t duration_ms;   // Note length in milliseconds
+} buzzer_note_t;
+
+/**
+ * @brief Initialize the buzzer pin and Timer3
+ * @return none
+ */
+void buzzer_init(void);
+
+/**
+ * @brief Start playing a melody in the background
+ * @param melody Pointer to a PROGMEM array of notes
+ * @param length Number of notes in the melody
+ * @return none
+ * @note Replaces any melody that is still playing
+ */
+void buzzer_play(const buzzer_note_t *melody, uint8_t length);
+
+/**
+ * @brief Play a single tone in the background
+ * @param freq_hz Tone frequency in Hz
+ * @param duration_ms Tone length in milliseconds
+ * @return none
+ */
+void buzzer_tone(uint16_t freq_hz, uint16_t duration_ms);
+
+/**
+ * @brief Stop playback and silence the buzzer
+ * @return none
+ */
+void buzzer_stop(void);
+
+/**
+ * @brief Check whether a melody or tone is still playing
+ * @return true while playing, false when idle
+ */
+bool buzzer_is_playing(void);
+
+#endif /* BUZZER_H */
@@ -1,15 +0,0 @@
-/* 
- * File:   i2c_test.h
- *  ESE 3500 test all I2C addresses on bus for peripheral
- * Author: James Steeman
- *
- * Created on February 22, 2025
- */
-
-#ifndef I2C_TEST_H
-#define	I2C_TEST_H
-
-void test_address(uint8_t address);
-
-#endif	/* I2C_TEST_H */
-
@@ -1,6 +1,5 @@
-#define F_CPU 16000000UL
+#include "drivers_config.h"
 #include <avr/io.h>
-#include <math.h>
 #include <util/delay.h>
 #include <avr/interrupt.h>
 #include "ST7735.h"
@@ -8,20 +7,55 @@
 #include "uart.h"
 #include "i2c.h"
 #include "max30102.h"
-
-// Custom RNG variables
-static uint16_t rand_seed = 1;
+#include "reels.h"
+#include "buzzer.h"
+#include "scheduler.h"
+#include "telemetry.h"
+#include "rng.h"
+#include "button.h"
+#include "nvstore.h"
+#include "plot.h"
 
 // Define I2C frequency
 #define I2C_FREQUENCY      400000UL  // 400kHz for MAX30102 communication
 
-// Define the number of samples to read in each iteration
+// Number of samples handed to the DSP per batch
 #define SAMPLE_COUNT       10
 
+// 1 streams every raw sample as binary telemetry frames, see telemetry.h
+#define TELEMETRY_ENABLE   0
+
+#if TELEMETRY_ENABLE && (SAMPLE_COUNT > TELEMETRY_MAX_SAMPLES)
+#error "SAMPLE_COUNT batches do not fit in one telemetry frame"
+#endif
+
 // Sample buffer
 max30102_fifo_sample_t samples[SAMPLE_COUNT];
 
-#define BUZZER_PIN PD5    // Buzzer connected to PD5/OC0B
+// State timing
+#define WELCOME_HOLD_MS    2000  // Welcome screen before the button prompt
+#define SPIN_HOLD_MS       3000  // Reels spin before the result
+#define RESULT_HOLD_MS     3000  // Result screen before the game over jingle
+#define GAME_TASK_MS       10    // State transitions are checked this often
+
+// Animation frame periods
+#define PROMPT_FRAME_MS    50    // Heart beat on the button prompt
+#define MEASURE_FRAME_MS   100   // PPG trace and heart rate readout
+#define SPIN_FRAME_MS      40    // 25 fps reel animation
+#define IDLE_FRAME_MS      100   // States without animation
+
+// Background task periods
+#define AUDIO_TASK_MS      200   // Reel sound while spinning
+#define LOG_TASK_MS        1000  // UART status output
+#define SENSOR_TASK_MS     10    // MAX30102 FIFO service
+#define STORE_TASK_MS      5     // EEPROM writes, one byte per 3.3 ms cycle
+
+// The sensor idles in presence mode until a finger shows up on the prompt,
+// and goes back once the finger has been gone this long
+#define PRESENCE_LOST_MS   3000
+
+// Longest play statistics line, with every counter at its maximum
+#define PLAY_STATS_LENGTH  72
 
 // Define states for the slot machine
 typedef enum {
@@ -29,206 +63,230 @@ typedef enum {
     STATE_PRESS_BUTTON,
     STATE_MEASURING,
     STATE_SPINNING,
-    STATE_RESULT
+    STATE_RESULT,
+    STATE_COUNT
 } SlotMachineState;
 
+// CPU residency of one state, accumulated over every visit
+typedef struct {
+    uint32_t totalMs;           // Time spent in the state
+    uint32_t busyMs;            // Part of it the CPU was awake
+} StateResidency;
+
+// Inputs the game reacts to, handed to the current state's onEvent
+typedef enum {
+    EVENT_BUTTON_PRESS,         // Debounced press edge
+    EVENT_BUTTON_LONG_PRESS,    // Button held for BUTTON_LONG_PRESS_MS
+    EVENT_HEART_RATE_READY,     // Sent every game tick while the HR is stable
+    EVENT_TIMEOUT,              // holdMs of the state has passed, sent once
+    EVENT_SOUND_DONE            // The buzzer finished its melody
+} GameEvent;
+
+// Inclusive screen rectangle
+typedef struct {
+    uint8_t x0, y0, x1, y1;
+} ScreenArea;
+
+// Behaviour of one state, NULL handlers are skipped
+typedef struct {
+    void (*onEnter)(void);              // Draw the static layout, once per visit
+    void (*onTick)(void);               // Draw what changed in one animation frame
+    void (*onEvent)(GameEvent event);   // May switch state with enterState()
+    void (*onExit)(void);               // Runs after the area was erased
+    uint16_t framePeriodMs;             // Time between onTick calls
+    uint16_t holdMs;                    // EVENT_TIMEOUT after this long, 0 never
+    ScreenArea area;                    // Everything the state draws
+} StateHandlers;
+
 // Global variables
 SlotMachineState currentState = STATE_WELCOME;
-volatile uint8_t buttonPressed = 0;
 uint8_t animationFrame = 0;
-uint8_t measureAnime = 0;
 max30102_result_t result;
-volatile uint32_t heartRate;
-volatile bool heartRateReady = false;
-uint8_t sample_count;
-uint8_t write_ptr, read_ptr, overflow;
-uint8_t int_status_1, int_status_2;
+uint32_t heartRate;
+bool heartRateReady = false;
+volatile bool sensorDataPending = false;
+uint32_t stateEnteredAt = 0;
+uint32_t fingerSeenAt = 0;
+uint8_t gameOverStarted = 0;
+bool timeoutSent = false;       // EVENT_TIMEOUT already sent in this state
+bool soundWasPlaying = false;   // Buzzer state on the previous game tick
+bool stateActive = false;       // False until the first state is entered
+bool storeLoaded = false;       // EEPROM held a record from an earlier boot
+int16_t shownRate = -1;         // Heart rate on the measuring screen, 0 for none
+bool shownStable = false;       // shownRate was drawn in the stable color
+uint8_t animationTaskId = SCHEDULER_INVALID_TASK;
+
+static const char *const stateNames[STATE_COUNT] = {
+    "welcome", "press button", "measuring", "spinning", "result"
+};
+
+// Busy time per state, reported over UART when the state is left
+StateResidency residency[STATE_COUNT];
+uint32_t stateIdleAt = 0;       // scheduler_idle_millis() when the state was entered
+bool residencyStarted = false;  // False until the first state is entered
+
+#if LCD_PROFILE
+// Draw time of the current screen, reported over UART when its state is left
+LCD_counters_t screenStart;     // Totals when the state was entered
+LCD_counters_t frameStart;      // Totals when the current frame started
+uint32_t screenCycles = 0;      // Cycles spent drawing this screen
+uint32_t screenMaxCycles = 0;   // Slowest single frame
+uint16_t screenFrames = 0;
+bool screenProfiled = false;    // False until the first state is entered
+#endif
 
 // Function prototypes
 void initialize(void);
-void displayWelcomeScreen(void);
-void displayPressButtonPrompt(void);
-void displayMeasuringPrompt(void);
-void displaySpinningPrompt(void);
-void displayResultScreen(uint8_t win);
-void setupButtonInterrupt(void);
+void welcomeEnter(void);
+void welcomeEvent(GameEvent event);
+void drawPromptHeart(uint8_t big);
+void promptEnter(void);
+void promptTick(void);
+void promptEvent(GameEvent event);
+void measuringEnter(void);
+void measuringTick(void);
+void measuringEvent(GameEvent event);
+void spinningEnter(void);
+void spinningTick(void);
+void spinningEvent(GameEvent event);
+void resultEnter(void);
+void resultEvent(GameEvent event);
+void enterState(SlotMachineState state);
+void dispatchEvent(GameEvent event);
+void gameTask(void);
+void animationTask(void);
+void audioTask(void);
+void logTask(void);
+void sensorTask(void);
+void profileFrameBegin(void);
+void profileFrameEnd(void);
+void profileScreenReport(void);
+void residencyReport(void);
+void serviceHeartRateSensor(uint8_t sample_count);
+void updateSensorPower(uint8_t sample_count);
 uint8_t determineWinOdds(void);
-uint16_t custom_rand(void);
-uint16_t custom_rand_range(uint16_t max);
-
-// Buzzer control functions
-void init_buzzer() {
-    // Set buzzer pin as output
-    DDRD |= (1 << BUZZER_PIN);
-}
-
-// Play specific frequencies with fixed delays
-void play_500hz(uint16_t duration_ms) {
-    uint16_t cycles = duration_ms;  // Each cycle is about 1ms for 500Hz
-    for (uint16_t i = 0; i < cycles; i++) {
-        PORTD |= (1 << BUZZER_PIN);
-        _delay_us(1000);  // Half period for 500Hz = 1000us
-        PORTD &= ~(1 << BUZZER_PIN);
-        _delay_us(1000);
-    }
-}
-
-void play_1000hz(uint16_t duration_ms) {
-    uint16_t cycles = duration_ms * 2;  // Each cycle is about 0.5ms for 1000Hz
-    for (uint16_t i = 0; i < cycles; i++) {
-        PORTD |= (1 << BUZZER_PIN);
-        _delay_us(500);  // Half period for 1000Hz = 500us
-        PORTD &= ~(1 << BUZZER_PIN);
-        _delay_us(500);
-    }
-}
-
-void play_1500hz(uint16_t duration_ms) {
-    uint16_t cycles = duration_ms * 3;  // Each cycle is about 0.33ms for 1500Hz
-    for (uint16_t i = 0; i < cycles; i++) {
-        PORTD |= (1 << BUZZER_PIN);
-        _delay_us(333);  // Half period for 1500Hz = 333us
-        PORTD &= ~(1 << BUZZER_PIN);
-        _delay_us(333);
-    }
-}
-
-void play_2000hz(uint16_t duration_ms) {
-    uint16_t cycles = duration_ms * 4;  // Each cycle is about 0.25ms for 2000Hz
-    for (uint16_t i = 0; i < cycles; i++) {
-        PORTD |= (1 << BUZZER_PIN);
-        _delay_us(250);  // Half period for 2000Hz = 250us
-        PORTD &= ~(1 << BUZZER_PIN);
-        _delay_us(250);
-    }
-}
-
-// Additional buzzer frequency functions
-void play_750hz(uint16_t duration_ms) {
-    uint16_t cycles = duration_ms * 1.5;  // Each cycle is about 0.67ms for 750Hz
-    for (uint16_t i = 0; i 
-            < cycles; i++) {
-        PORTD |= (1 << BUZZER_PIN);
-        _delay_us(667);  // Half period for 750Hz = 667us
-        PORTD &= ~(1 << BUZZER_PIN);
-        _delay_us(667);
-    }
-}
-
-void play_1250hz(uint16_t duration_ms) {
-    uint16_t cycles = duration_ms * 2.5;  // Each cycle is about 0.4ms for 1250Hz
-    for (uint16_t i = 0; i < cycles; i++) {
-        PORTD |= (1 << BUZZER_PIN);
-        _delay_us(400);  // Half period for 1250Hz = 400us
-        PORTD &= ~(1 << BUZZER_PIN);
-        _delay_us(400);
-    }
-}
-
-void play_2500hz(uint16_t duration_ms) {
-    uint16_t cycles = duration_ms * 5;  // Each cycle is about 0.2ms for 2500Hz
-    for (uint16_t i = 0; i < cycles; i++) {
-        PORTD |= (1 << BUZZER_PIN);
-        _delay_us(200);  // Half period for 2500Hz = 200us
-        PORTD &= ~(1 << BUZZER_PIN);
-        _delay_us(200);
-    }
-}
-
-void play_3000hz(uint16_t duration_ms) {
-    uint16_t cycles = duration_ms * 6;  // Each cycle is about 0.167ms for 3000Hz
-    for (uint16_t i = 0; i < cycles; i++) {
-        PORTD |= (1 << BUZZER_PIN);
-        _delay_us(167);  // Half period for 3000Hz = 167us
-        PORTD &= ~(1 << BUZZER_PIN);
-        _delay_us(167);
-    }
-}
+void recordGame(uint8_t win, uint8_t jackpot);
+void printPlayStats(void);
+
+// The game, one row per state. Leaving a state erases only its area, the
+// next layout is drawn onto black without clearing the whole panel.
+static const StateHandlers stateTable[STATE_COUNT] = {
+    [STATE_WELCOME] = {
+        welcomeEnter, NULL, welcomeEvent, NULL,
+        IDLE_FRAME_MS, WELCOME_HOLD_MS, { 10, 10, 150, 112 }
+    },
+    [STATE_PRESS_BUTTON] = {
+        promptEnter, promptTick, promptEvent, NULL,
+        PROMPT_FRAME_MS, 0, { 5, 15, 154, 117 }
+    },
+    [STATE_MEASURING] = {
+        measuringEnter, measuringTick, measuringEvent, NULL,
+        MEASURE_FRAME_MS, 0, { 5, 15, LCD_WIDTH - 1, 107 }
+    },
+    [STATE_SPINNING] = {
+        spinningEnter, spinningTick, spinningEvent, NULL,
+        SPIN_FRAME_MS, SPIN_HOLD_MS, { 26, 12, 134, 90 }
+    },
+    [STATE_RESULT] = {
+        resultEnter, NULL, resultEvent, NULL,
+        IDLE_FRAME_MS, RESULT_HOLD_MS, { 0, 8, LCD_WIDTH - 1, 90 }
+    },
+};
+
+// Melodies, played in the background by the buzzer sequencer
+#define MELODY_LENGTH(m) (sizeof(m) / sizeof((m)[0]))
+
+static const buzzer_note_t welcome_theme[] PROGMEM = {
+    {1000, 80}, {BUZZER_REST, 20},
+    {1500, 80}, {BUZZER_REST, 20},
+    {2000, 100}, {BUZZER_REST, 30},
+    {2500, 150}
+};
+
+static const buzzer_note_t button_press[] PROGMEM = {
+    {1500, 30}, {2000, 20}
+};
+
+static const buzzer_note_t measuring_sound[] PROGMEM = {
+    {750, 30}, {BUZZER_REST, 10},
+    {1000, 30}, {BUZZER_REST, 10},
+    {1250, 30}
+};
+
+// Slot machine reel spinning sound
+static const buzzer_note_t spinning_sound[] PROGMEM = {
+    {2000, 10}, {BUZZER_REST, 5}, {1500, 10}, {BUZZER_REST, 5},
+    {2000, 10}, {BUZZER_REST, 5}, {1500, 10}, {BUZZER_REST, 5},
+    {2000, 10}, {BUZZER_REST, 5}, {1500, 10}, {BUZZER_REST, 5}
+};
+
+// Exciting jackpot sound
+static const buzzer_note_t big_win_sound[] PROGMEM = {
+    {2000, 50}, {BUZZER_REST, 20},
+    {2500, 50}, {BUZZER_REST, 20},
+    {3000, 100}, {BUZZER_REST, 50},
+    {2500, 50}, {BUZZER_REST, 20},
+    {3000, 150}, {BUZZER_REST, 20},
+    {2000, 50}, {BUZZER_REST, 20},
+    {2500, 50}, {BUZZER_REST, 20},
+    {3000, 200}
+};
+
+// Smaller win sound
+static const buzzer_note_t small_win_sound[] PROGMEM = {
+    {1500, 40}, {BUZZER_REST, 20},
+    {2000, 40}, {BUZZER_REST, 20},
+    {2500, 80}, {BUZZER_REST, 30},
+    {3000, 120}
+};
+
+// Downward wah-wah sound
+static const buzzer_note_t lose_sound[] PROGMEM = {
+    {1000, 70}, {BUZZER_REST, 10},
+    {750, 70}, {BUZZER_REST, 10},
+    {500, 150}
+};
+
+// Game over jingle
+static const buzzer_note_t game_over_sound[] PROGMEM = {
+    {1000, 80}, {BUZZER_REST, 20},
+    {750, 80}, {BUZZER_REST, 20},
+    {500, 80}, {BUZZER_REST, 100},
+    {750, 80}, {BUZZER_REST, 20},
+    {500, 160}, {BUZZER_REST, 250}
+};
 
 // Sound pattern functions
 void play_welcome_theme(void) {
-    play_1000hz(80);
-    _delay_ms(20);
-    play_1500hz(80);
-    _delay_ms(20);
-    play_2000hz(100);
-    _delay_ms(30);
-    play_2500hz(150);
+    buzzer_play(welcome_theme, MELODY_LENGTH(welcome_theme));
 }
 
 void play_button_press(void) {
-    play_1500hz(30);
-    play_2000hz(20);
+    buzzer_play(button_press, MELODY_LENGTH(button_press));
 }
 
 void play_measuring_sound(void) {
-    play_750hz(30);
-    _delay_ms(10);
-    play_1000hz(30);
-    _delay_ms(10);
-    play_1250hz(30);
+    buzzer_play(measuring_sound, MELODY_LENGTH(measuring_sound));
 }
 
 void play_spinning_sound(void) {
-    // Slot machine reel spinning sound
-    for (uint8_t i = 0; i < 3; i++) {
-        play_2000hz(10);
-        _delay_ms(5);
-        play_1500hz(10);
-        _delay_ms(5);
-    }
+    buzzer_play(spinning_sound, MELODY_LENGTH(spinning_sound));
 }
 
 void play_win_sound(uint8_t big_win) {
     if (big_win) {
-        // Exciting jackpot sound
-        play_2000hz(50);
-        _delay_ms(20);
-        play_2500hz(50);
-        _delay_ms(20);
-        play_3000hz(100);
-        _delay_ms(50);
-        play_2500hz(50);
-        _delay_ms(20);
-        play_3000hz(150);
-        _delay_ms(20);
-        play_2000hz(50);
-        _delay_ms(20);
-        play_2500hz(50);
-        _delay_ms(20);
-        play_3000hz(200);
+        buzzer_play(big_win_sound, MELODY_LENGTH(big_win_sound));
     } else {
-        // Smaller win sound
-        play_1500hz(40);
-        _delay_ms(20);
-        play_2000hz(40);
-        _delay_ms(20);
-        play_2500hz(80);
-        _delay_ms(30);
-        play_3000hz(120);
+        buzzer_play(small_win_sound, MELODY_LENGTH(small_win_sound));
     }
 }
 
 void play_lose_sound(void) {
-    // Downward wah-wah sound
-    play_1000hz(70);
-    _delay_ms(10);
-    play_750hz(70);
-    _delay_ms(10);
-    play_500hz(150);
+    buzzer_play(lose_sound, MELODY_LENGTH(lose_sound));
 }
 
 void play_game_over_sound(void) {
-    // Game over jingle
-    play_1000hz(80);
-    _delay_ms(20);
-    play_750hz(80);
-    _delay_ms(20);
-    play_500hz(80);
-    _delay_ms(100);
-    play_750hz(80);
-    _delay_ms(20);
-    play_500hz(160);
+    buzzer_play(game_over_sound, MELODY_LENGTH(game_over_sound));
 }
 
 bool init_peripherals(void) {
@@ -243,15 +301,26 @@ bool init_peripherals(void) {
     }
     printf("MAX30102 sensor initialized\r\n");
     
-    // Configure MAX30102 with default settings
+    // Starting point for the AGC, which moves the LED current and ADC range
+    // to keep the DC level mid-scale for the finger on the sensor
     max30102_led_amplitude_t led_amplitude = {
         .red = 0x1F,  // ~6.4mA
         .ir = 0x1F    // ~6.4mA
     };
+    max30102_adc_range_t adc_range = MAX30102_ADC_RANGE_16384_NA;
+    
+    // Warm start from where the AGC ended the last game, so the first game
+    // after boot does not have to learn it again
+    if (storeLoaded && nvstore_get()->adc_range <= MAX30102_ADC_RANGE_16384_NA) {
+        led_amplitude = nvstore_get()->led;
+        adc_range = (max30102_adc_range_t)nvstore_get()->adc_range;
+        printf("AGC restored: IR 0x%02X, red 0x%02X, range %u nA\r\n",
+               led_amplitude.ir, led_amplitude.red, 2048U << adc_range);
+    }
     
     if (!max30102_configure(MAX30102_SAMPLE_RATE_100_HZ, 
                            MAX30102_PULSE_WIDTH_411_US,
-                           MAX30102_ADC_RANGE_16384_NA,
+                           adc_range,
                            led_amplitude)) {
         printf("Failed to configure MAX30102 sensor\r\n");
         return false;
@@ -278,47 +347,55 @@ bool init_peripherals(void) {
 void initialize(void) {
     // Initialize LCD
     lcd_init();
+#if LCD_PROFILE
+    LCD_profileInit();
+#endif
     
-    init_buzzer();
-    
-    // Setup button input with internal pull-up
-    // Using PD2 (INT0) as the button input pin
-    DDRD &= ~(1 << DDD2);  // Set PD2 as input
-    PORTD |= (1 << PORTD2); // Enable pull-up resistor
+    buzzer_init();
     
     // Initialize UART for debugging
     uart_init();
+    
+    // Statistics and sensor calibration from the last power cycle
+    storeLoaded = nvstore_init();
+    
     if (!init_peripherals()) {
+        // Interrupts are still off, push the error message out by polling
+        uart_flush();
         while (1) {
             // Halt on error
             _delay_ms(1000);
         }
     }
     
-    // Setup button interrupt
-    setupButtonInterrupt();
+    // Start the 1 ms system tick
+    scheduler_init();
+    
+    // Sample the button on PD2 from the same timer
+    button_init();
 
     // Initialize the screen
     LCD_setScreen(BLACK);
     
-    // Seed the random number generator with ADC noise
-    // Enable ADC and set prescaler to 128
-    ADCSRA = (1 << ADEN) | (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
-    // Select ADC channel 0 (can be any unused analog input)
-    ADMUX = 0;
-    
-    // Do a few readings to seed our random number generator
-    for (uint8_t i = 0; i < 16; i++) {
-        // Start conversion
-        ADCSRA |= (1 << ADSC);
-        // Wait for conversion to complete
-        while (ADCSRA & (1 << ADSC));
-        // Use the least significant bits as they're noisier
-        rand_seed = (rand_seed << 1) | (ADC & 0x01);
+    // Seed the random number generator with ADC noise and start the
+    // watchdog jitter source
+    rng_init();
+    if (storeLoaded) {
+        rng_restore(nvstore_get()->rng_seed);
     }
     
-    // Make sure seed is never 0
-    if (rand_seed == 0) rand_seed = 0x1234;
+    // Seeding was the last ADC use, rng_init() left it disabled. Power it
+    // down along with the second USART, SPI and TWI, Timer4 and the touch
+    // controller, none are wired up.
+    PRR0 |= (1 << PRADC) | (1 << PRUSART1);
+#if !LCD_PROFILE
+    PRR0 |= (1 << PRTIM1);
+#endif
+    PRR1 |= (1 << PRTWI1) | (1 << PRPTC) | (1 << PRTIM4) | (1 << PRSPI1);
+    
+    // The setup messages fill most of the transmit buffer, push them out by
+    // polling so the banner below is not dropped
+    uart_flush();
     
     // Enable global interrupts
     sei();
@@ -326,24 +403,18 @@ void initialize(void) {
     // Print debug info
     printf("T&T Slots - Sense the Win\r\n");
     printf("System Initialized\r\n");
-    
+    printPlayStats();
 }
 
-// Setup button interrupt on INT0 (PD2)
-void setupButtonInterrupt(void) {
-    // Configure INT0 to trigger on falling edge
-    EICRA |= (1 << ISC01);
-    EICRA &= ~(1 << ISC00);
-    
-    // Enable INT0 interrupt
-    EIMSK |= (1 << INT0);
-}
-
-// Display welcome screen
-void displayWelcomeScreen(void) {
-    LCD_setScreen(BLACK);
+// Welcome: title and border, moves on to the prompt after WELCOME_HOLD_MS
+void welcomeEnter(void) {
+    // Nobody to measure yet, just watch for a finger
+    max30102_set_power_mode(MAX30102_POWER_PRESENCE);
     play_welcome_theme();
     
+    // The last game is written out now, never while one is being played
+    nvstore_save();
+    
     // Display title
     LCD_drawString(20, 20, "T&T SLOTS", YELLOW, BLACK);
     LCD_drawString(15, 40, "Sense the Win", RED, BLACK);
@@ -357,211 +428,195 @@ void displayWelcomeScreen(void) {
     // Display instructions
     LCD_drawString(15, 70, "Press Button", WHITE, BLACK);
     LCD_drawString(25, 85, "to Start", WHITE, BLACK);
-    
-    // Wait for a moment before proceeding
-    _delay_ms(2000);
-    
-    // Transition to next state
-    currentState = STATE_PRESS_BUTTON;
 }
 
-// Display prompt to press the button
-void displayPressButtonPrompt(void) {
-    static uint8_t promptDisplayed = 0;
-    
-    if (!promptDisplayed) {
-        LCD_setScreen(BLACK);
-        
-        // Draw header
-        LCD_drawString(15, 15, "READY TO PLAY?", GREEN, BLACK);
-        
-        // Draw button prompt
-        LCD_drawString(5, 40, "Press the Button (gently)", WHITE, BLACK);
-        LCD_drawString(20, 55, "to try your luck!", WHITE, BLACK);
-        
-        // Draw a simple button graphic
-        LCD_drawBlock(60, 70, 100, 90, BLUE);
-        LCD_drawString(67, 78, "PLAY", WHITE, BLUE);
-        
-        // Draw a heart symbol
-        LCD_drawDisk(80, 105, 10, RED);
-        LCD_drawDisk(90, 105, 10, RED);
-        LCD_drawBlock(80, 105, 90, 115, RED);
-        LCD_drawBlock(75, 100, 95, 105, BLACK);
-        LCD_drawBlock(85, 115, 86, 116, RED);
-        
-        promptDisplayed = 1;
+void welcomeEvent(GameEvent event) {
+    if (event == EVENT_TIMEOUT) {
+        enterState(STATE_PRESS_BUTTON);
     }
+}
+
+// Draw the heart on the prompt, big for the beat
+void drawPromptHeart(uint8_t big) {
+    LCD_drawDisk(80, 105, 10 + big, RED);
+    LCD_drawDisk(90, 105, 10 + big, RED);
+    LCD_drawBlock(80, 105, 90, 115 + big, RED);
+    LCD_drawBlock(75, 100, 95, 105, BLACK);
+    LCD_drawBlock(85, 115 + big, 86, 116 + big, RED);
+}
+
+// Prompt: wait for the button, the heart beats meanwhile
+void promptEnter(void) {
+    // Draw header
+    LCD_drawString(15, 15, "READY TO PLAY?", GREEN, BLACK);
+    
+    // Draw button prompt
+    LCD_drawString(5, 40, "Press the Button (gently)", WHITE, BLACK);
+    LCD_drawString(20, 55, "to try your luck!", WHITE, BLACK);
+    
+    // Draw a simple button graphic
+    LCD_drawBlock(60, 70, 100, 90, BLUE);
+    LCD_drawString(67, 78, "PLAY", WHITE, BLUE);
     
-    // Simple animation for the heart
+    drawPromptHeart(0);
+}
+
+void promptTick(void) {
+    // Make heart "beat" occasionally, only the two frames that change it draw
     if (animationFrame % 10 == 0) {
-        // Make heart "beat" occasionally
-        LCD_drawDisk(80, 105, 11, RED);
-        LCD_drawDisk(90, 105, 11, RED);
-        LCD_drawBlock(80, 105, 90, 116, RED);
-        LCD_drawBlock(75, 100, 95, 105, BLACK);
-        LCD_drawBlock(85, 116, 86, 117, RED);
+        drawPromptHeart(1);
     } else if (animationFrame % 10 == 1) {
         // Return to normal size
-        LCD_drawDisk(80, 105, 10, RED);
-        LCD_drawDisk(90, 105, 10, RED);
-        LCD_drawBlock(80, 105, 90, 115, RED);
-        LCD_drawBlock(75, 100, 95, 105, BLACK);
-        LCD_drawBlock(85, 115, 86, 116, RED);
-    }
-    
-    animationFrame++;
-    _delay_ms(50);
-    
-    // Reset if we change states
-    if (currentState != STATE_PRESS_BUTTON) {
-        promptDisplayed = 0;
+        drawPromptHeart(0);
     }
 }
 
-// Display measuring heart rate prompt
-void displayMeasuringPrompt(void) {
-    static uint8_t lastHeartRateDisplayed = 0;
-//    printf("measuring1\n");
-    
-    // First, clear screen and setup initial display
-    if (measureAnime == 0) {
-        measureAnime = 1;
-        LCD_setScreen(BLACK);
-        LCD_drawString(5, 15, "CHARGING UP YOUR WIN...", CYAN, BLACK);
-        LCD_drawString(10, 70, "Keep finger on button top...", WHITE, BLACK);
-        LCD_drawString(10, 85, "and press more times!", WHITE, BLACK);
+void promptEvent(GameEvent event) {
+    if (event == EVENT_BUTTON_PRESS) {
+        printf("button pressed\r\n");
+        play_button_press();
+        enterState(STATE_MEASURING);
     }
-    
+}
 
+// Measuring: spinner until the heart rate is stable
+void measuringEnter(void) {
+    heartRateReady = false;
+    // No-op if a finger already woke the sensor on the prompt
+    max30102_set_power_mode(MAX30102_POWER_ACTIVE);
+    
+    LCD_drawString(5, 15, "CHARGING UP YOUR WIN...", CYAN, BLACK);
+    plot_begin(10, 28, 149, 62);
+    LCD_drawString(10, 70, "Keep finger on button top...", WHITE, BLACK);
+    LCD_drawString(10, 85, "and press more times!", WHITE, BLACK);
+    shownRate = -1;
+}
+
+void measuringTick(void) {
+    int16_t rate = 0;
+    char text[16];
     
-//    printf("measuring3\n");
+    // Columns queued by sensorTask since the last frame
+    plot_update();
     
-    // Draw progress animation
-    switch(animationFrame % 4) {
-        case 0:
-            LCD_drawString(70, 40, "|", WHITE, BLACK);
-//            play_measuring_sound();
-            break;
-        case 1:
-            LCD_drawString(70, 40, "/", WHITE, BLACK);
-            break;
-        case 2:
-            LCD_drawString(70, 40, "-", WHITE, BLACK);
-//            play_measuring_sound();
-            break;
-        case 3:
-            LCD_drawString(70, 40, "\\", WHITE, BLACK);
-            break;
+    // Live estimate, redrawn only when it or its stability changes
+    if (result.hr_valid && result.heart_rate > 0 && result.heart_rate < 1000) {
+        rate = (int16_t)result.heart_rate;
+    }
+    if (rate != shownRate || result.hr_stable != shownStable) {
+        shownRate = rate;
+        shownStable = result.hr_stable;
+        if (rate > 0) {
+            snprintf(text, sizeof(text), "HR: %3u BPM", (uint16_t)rate);
+        } else {
+            snprintf(text, sizeof(text), "HR: --- BPM");
+        }
+        LCD_drawString(10, 100, text, result.hr_stable ? GREEN : WHITE, BLACK);
     }
-    
-    // Update animation frame
-    animationFrame++;
-    
-//    printf("measuring4\n");
-    
-    // Timing for animation
-    _delay_ms(250);
 }
 
-// Display spinning wheels prompt
-void displaySpinningPrompt(void) {
-    LCD_setScreen(BLACK);
+void measuringEvent(GameEvent event) {
+    if (event == EVENT_HEART_RATE_READY) {
+        printf("HR=%u BPM\r\n", heartRate);
+        
+        // Determine odds and start spinning
+        enterState(STATE_SPINNING);
+    }
+}
+
+// Spinning: reel animation for SPIN_HOLD_MS
+void spinningEnter(void) {
+    // The heart rate is in, the sensor sleeps until the next game
+    max30102_set_power_mode(MAX30102_POWER_SHUTDOWN);
     
     // Draw header
-    LCD_drawString(30, 15, "SPINNING!", MAGENTA, BLACK);
+    LCD_drawStringScaled(26, 12, "SPINNING!", 2, MAGENTA, BLACK);
     
-    if (animationFrame % 2 == 0) {
-        play_spinning_sound();
+    // Draw wheel borders
+    reels_begin(50, 90);
+}
+
+void spinningTick(void) {
+    // Pick the next symbol of every wheel, only changed cells are redrawn
+    for (uint8_t wheel = 0; wheel < REEL_COUNT; wheel++) {
+        reels_setSymbol(wheel, rng_range(REEL_SYMBOL_COUNT));
     }
-    
-    // Display heart rate info
-//    char hrBuffer[20];
-//    sprintf(hrBuffer, "Your HR: %3d BPM", heartRate);
-//    LCD_drawString(20, 30, hrBuffer, WHITE, BLACK);
-    
-    // Draw spinning wheels
-    char symbols[4] = {'7', '$', '#', '@'};
-    
-    for (uint8_t wheel = 0; wheel < 3; wheel++) {
-        // Calculate position for each wheel
-        uint8_t x = 40 + wheel * 40;
-        
-        // Draw wheel border
-        LCD_drawBlock(x - 10, 50, x + 10, 90, BLUE);
-        
-        // Draw current symbol
-        char symbol = symbols[custom_rand_range(4)];
-        LCD_drawChar(x - 3, 65, symbol, WHITE, BLUE);
+    reels_update();
+}
+
+void spinningEvent(GameEvent event) {
+    if (event == EVENT_TIMEOUT) {
+        enterState(STATE_RESULT);
     }
-    
-    // Update animation frame
-    animationFrame++;
-    rand_seed ^= (uint16_t)TCNT0;
-    
-    // Slow down animation
-    _delay_ms(200);
 }
 
-// Display result screen
-void displayResultScreen(uint8_t win) {
-    LCD_setScreen(BLACK);
-    char symbols[4] = {'7', '$', '#', '@'};
+// Result: win or lose by the heart rate odds, then the game over jingle
+void resultEnter(void) {
+    // Determine win based on heart rate
+    uint8_t win = (rng_range(100) < determineWinOdds());
+    
+    gameOverStarted = 0;
     
     if (win) {
-        uint8_t jackpot = (custom_rand_range(10) < 5);  // 20% chance of jackpot on win
+        uint8_t jackpot = (rng_range(2) == 0);  // Half of the wins are jackpots
         
+        recordGame(1, jackpot);
         play_win_sound(jackpot);
         
         // Win screen
         if (jackpot) {
-            LCD_drawString(30, 10, "JACKPOT!!", YELLOW, BLACK);
+            LCD_drawStringScaled(26, 8, "JACKPOT!!", 2, YELLOW, BLACK);
             LCD_drawString(20, 30, "BIG WIN!!!", GREEN, BLACK);
         } else {
-            LCD_drawString(30, 10, "YOU WIN!", YELLOW, BLACK);
+            LCD_drawStringScaled(32, 8, "YOU WIN!", 2, YELLOW, BLACK);
             LCD_drawString(20, 30, "GOOD LUCK!", GREEN, BLACK);
         }
         
-        for (uint8_t wheel = 0; wheel < 3; wheel++) {
-            // Calculate position for each wheel
-            uint8_t x = 40 + wheel * 40;
-
-            // Draw wheel border
-            LCD_drawBlock(x - 10, 65, x + 10, 90, BLUE);
-
-            // Draw current symbol
-            char symbol = symbols[jackpot];
-            LCD_drawChar(x - 3, 80, symbol, WHITE, BLUE);
+        reels_begin(65, 90);
+        for (uint8_t wheel = 0; wheel < REEL_COUNT; wheel++) {
+            reels_setSymbol(wheel, jackpot);
         }
+        reels_update();
     } else {
+        recordGame(0, 0);
         play_lose_sound();
         // Lose screen
-        LCD_drawString(30, 10, "TRY AGAIN", RED, BLACK);
+        LCD_drawStringScaled(26, 8, "TRY AGAIN", 2, RED, BLACK);
         LCD_drawString(15, 30, "Better luck", WHITE, BLACK);
         LCD_drawString(20, 45, "next time!", WHITE, BLACK);
         
-        
-    
-        for (uint8_t wheel = 0; wheel < 3; wheel++) {
-            // Calculate position for each wheel
-            uint8_t x = 40 + wheel * 40;
-
-            // Draw wheel border
-            LCD_drawBlock(x - 10, 65, x + 10, 90, BLUE);
-
-            // Draw current symbol
-            char symbol = symbols[custom_rand_range(4)];
-            LCD_drawChar(x - 3, 80, symbol, WHITE, BLUE);
+        reels_begin(65, 90);
+        for (uint8_t wheel = 0; wheel < REEL_COUNT; wheel++) {
+            reels_setSymbol(wheel, rng_range(REEL_SYMBOL_COUNT));
         }
+        reels_update();
+    }
+}
+
+void resultEvent(GameEvent event) {
+    switch (event) {
+        case EVENT_BUTTON_LONG_PRESS:
+            // Skip straight back to welcome
+            buzzer_stop();
+            enterState(STATE_WELCOME);
+            break;
+            
+        case EVENT_TIMEOUT:
+            // Held for RESULT_HOLD_MS, play the jingle
+            play_game_over_sound();
+            gameOverStarted = 1;
+            break;
+            
+        case EVENT_SOUND_DONE:
+            // The win or lose sound ending does not count
+            if (gameOverStarted) {
+                enterState(STATE_WELCOME);
+            }
+            break;
+            
+        default:
+            break;
     }
-    
-    // Wait for a moment
-    _delay_ms(3000);
-    play_game_over_sound();
-    _delay_ms(250);
-    
-    // Return to welcome screen
-    currentState = STATE_WELCOME;
 }
 
 
@@ -595,161 +650,358 @@ uint8_t determineWinOdds() {
     return winPercentage;
 }
 
-// Button interrupt handler
-ISR(INT0_vect) {
-    // Debounce
-    _delay_ms(10);
-    
-//    // Check if button is still pressed
-//    if (!(PIND & (1 << PIND2))) {
-//        // Button was pressed
-//        buttonPressed = 1;
-//        printf("pressing\n");
-//        // If we're in PRESS_BUTTON state, move to MEASURING state
-//        if (currentState == STATE_PRESS_BUTTON) {
-//            currentState = STATE_MEASURING;
-//            animationFrame = 0;
-//        }
-//    }
-    
-    // Button was pressed
-    printf("button pressed\n");
-    if (currentState == STATE_PRESS_BUTTON) {
-        play_button_press();
-        animationFrame = 0;
-        currentState = STATE_MEASURING;  
-        
+
+
+// Count the game and keep the calibration it ended on. Only the RAM copy
+// changes here, welcomeEnter() starts the EEPROM write.
+void recordGame(uint8_t win, uint8_t jackpot) {
+    nvstore_record_t record = *nvstore_get();
+    max30102_adc_range_t range;
+    
+    record.spins++;
+    if (win) {
+        record.wins++;
     }
+    if (jackpot) {
+        record.jackpots++;
+    }
+    record.hr_sum += heartRate;
+    
+    // The sensor is shut down since spinning, so the AGC settings are final
+    max30102_agc_get(&record.led, &range);
+    record.adc_range = range;
+    record.rng_seed = rng_save();
+    
+    nvstore_set(&record);
 }
 
-
+// Lifetime statistics kept in EEPROM
+void printPlayStats(void) {
+    const nvstore_record_t *stats = nvstore_get();
+    
+    // The transmit buffer drops what does not fit, wait for the whole line
+    while (uart_tx_free() < PLAY_STATS_LENGTH);
+    
+    if (stats->spins == 0) {
+        printf("No games played yet\r\n");
+        return;
+    }
+    printf("Games %lu, won %lu%%, jackpots %lu, avg HR %lu BPM\r\n",
+           stats->spins, stats->wins * 100 / stats->spins,
+           stats->jackpots, stats->hr_sum / stats->spins);
+}
 
 // Heart rate sensor interrupt handler (INT1 - PD3)
+// Only flags the event, the FIFO is drained by sensorTask in main context
 ISR(INT1_vect) {
-    if (max30102_read_interrupt_status(&int_status_1, &int_status_2)) {
-                if (int_status_1 & MAX30102_INT_A_FULL) {
-                    // printf("INT detected via polling: 0x%02X\r\n", int_status_1);
-                    
-                    // Read FIFO pointers to determine how many samples to read
-                    if (max30102_read_fifo_ptrs(&write_ptr, &read_ptr, &overflow)) {
-                        // Calculate number of samples to read
-                        if (write_ptr >= read_ptr) {
-                            sample_count = write_ptr - read_ptr;
-                        } else {
-                            sample_count = 32 - read_ptr + write_ptr;  // FIFO is 32 samples deep
-                        }
-                        
-                        // Cap sample count to buffer size
-                        if (sample_count > SAMPLE_COUNT) {
-                            sample_count = SAMPLE_COUNT;
-                        }
-                        
-                        // Only process data if we have enough samples
-                        if (sample_count >= 5) {
-                            // Read samples from FIFO
-                            sample_count = max30102_read_fifo_samples(samples, sample_count);
-                            
-                            // Process samples to calculate heart rate and SpO2
-                            if (max30102_calculate_hr_spo2(samples, sample_count, &result)) {
-                                
-                                heartRateReady = result.hr_valid;
-                                
-                                // Print heart rate and validity
-                                if (heartRateReady) {
-//                                    printf("%ld\tValid\t\t\n", result.heart_rate);
-                                    heartRate = result.heart_rate;
-                                } else {
-//                                    printf("--\tInvalid\t\t\n");
-                                }
-
-                            }
-                        }
-                    }
-                }
+    sensorDataPending = true;
+}
+
+// Update the heart rate from a freshly drained batch of samples
+void serviceHeartRateSensor(uint8_t sample_count) {
+    // Process samples to calculate heart rate and SpO2
+    if (max30102_calculate_hr_spo2(samples, sample_count, &result)) {
+        // Move on as soon as the reading settles, not on the first estimate
+        heartRateReady = result.hr_stable;
+        
+        if (heartRateReady) {
+            heartRate = result.heart_rate;
+        }
+    }
+}
+
+// Wake the sensor for a finger on the prompt, idle it again when it leaves.
+// Runs before the DSP, which filters the batch in place.
+void updateSensorPower(uint8_t sample_count) {
+    max30102_power_mode_t mode = max30102_get_power_mode();
+    uint32_t now = scheduler_millis();
+    bool present = false;
+    
+    for (uint8_t i = 0; i < sample_count && !present; i++) {
+        present = max30102_presence_detected(&samples[i]);
+    }
+    if (present) {
+        fingerSeenAt = now;
+    }
+    
+    // Once measuring the state machine owns the power mode
+    if (currentState != STATE_WELCOME && currentState != STATE_PRESS_BUTTON) {
+        return;
+    }
+    
+    // Waking early lets the AGC settle before the button is pressed
+    if (present && mode == MAX30102_POWER_PRESENCE) {
+        printf("Finger detected\r\n");
+        max30102_set_power_mode(MAX30102_POWER_ACTIVE);
+    } else if (!present && mode == MAX30102_POWER_ACTIVE &&
+               now - fingerSeenAt >= PRESENCE_LOST_MS) {
+        max30102_set_power_mode(MAX30102_POWER_PRESENCE);
+    }
+}
+
+// Sensor consumer, the FIFO is drained by the TWI ISR in the background
+// and the DSP runs here in main context
+void sensorTask(void) {
+    uint8_t count;
+    
+    // Collect the previous drain, the TWI ISR did the bus work
+    max30102_fifo_read_complete();
+    
+    // Feed the DSP from the ring in batches
+    while (max30102_stream_available() > 0) {
+        count = 0;
+        while (count < SAMPLE_COUNT && max30102_stream_pop(&samples[count])) {
+            // Shot noise sits in the low bits of every sample
+            rng_add_entropy(((uint16_t)samples[count].red << 8) ^
+                            (uint16_t)samples[count].ir);
+            count++;
+        }
+#if TELEMETRY_ENABLE
+        telemetry_send_samples(samples, count);
+#endif
+        // Presence samples only tell if a finger is there
+        if (max30102_get_power_mode() == MAX30102_POWER_ACTIVE) {
+            // Queue a trace column before the DSP filters the batch in place
+            if (currentState == STATE_MEASURING) {
+                plot_addSamples(samples, count);
             }
+            serviceHeartRateSensor(count);
+        }
+        updateSensorPower(count);
+    }
+    
+    // The INT pin stays low until the status is read, so also check the
+    // level in case an edge arrived before interrupts were enabled
+    if (!max30102_fifo_read_busy() &&
+        (sensorDataPending || !(PIND & (1 << PD3)))) {
+        sensorDataPending = false;
+        max30102_fifo_read_start();
+    }
+}
+
+// Switch state: erase the old state's area, then draw the new layout once
+void enterState(SlotMachineState state) {
+    const StateHandlers *handlers;
+    
+    if (stateActive) {
+        handlers = &stateTable[currentState];
+        profileFrameBegin();
+        LCD_drawBlock(handlers->area.x0, handlers->area.y0,
+                      handlers->area.x1, handlers->area.y1, BLACK);
+        if (handlers->onExit != NULL) {
+            handlers->onExit();
+        }
+        profileFrameEnd();
+    }
+    stateActive = true;
+    
+    profileScreenReport();
+    residencyReport();
+    currentState = state;
+    stateEnteredAt = scheduler_millis();
+    stateIdleAt = scheduler_idle_millis();
+    animationFrame = 0;
+    timeoutSent = false;
+    // Presses made before the state was entered do not count
+    button_flush();
+    
+    handlers = &stateTable[state];
+    if (handlers->onEnter != NULL) {
+        profileFrameBegin();
+        handlers->onEnter();
+        profileFrameEnd();
+    }
+    scheduler_set_period(animationTaskId, handlers->framePeriodMs);
+}
+
+// Hand one event to the current state
+void dispatchEvent(GameEvent event) {
+    void (*onEvent)(GameEvent event) = stateTable[currentState].onEvent;
+    
+    if (onEvent != NULL) {
+        onEvent(event);
+    }
+}
+
+// Turn inputs into events, runs every GAME_TASK_MS and never blocks.
+// Once a handler switches state the remaining inputs belong to the old one.
+void gameTask(void) {
+    SlotMachineState state = currentState;
+    uint16_t holdMs = stateTable[state].holdMs;
+    button_event_t buttonEvent = button_get_event();
+    bool playing = buzzer_is_playing();
+    bool soundDone = soundWasPlaying && !playing;
+    
+    soundWasPlaying = playing;
+    
+    if (buttonEvent == BUTTON_EVENT_PRESS) {
+        dispatchEvent(EVENT_BUTTON_PRESS);
+    } else if (buttonEvent == BUTTON_EVENT_LONG_PRESS) {
+        dispatchEvent(EVENT_BUTTON_LONG_PRESS);
+    }
+    if (currentState != state) {
+        return;
+    }
     
-    // Update RNG seed on each interrupt for more randomness
+    if (heartRateReady) {
+        dispatchEvent(EVENT_HEART_RATE_READY);
+        if (currentState != state) {
+            return;
+        }
+    }
     
+    if (soundDone) {
+        dispatchEvent(EVENT_SOUND_DONE);
+        if (currentState != state) {
+            return;
+        }
+    }
+    
+    if (holdMs != 0 && !timeoutSent &&
+        scheduler_millis() - stateEnteredAt >= holdMs) {
+        timeoutSent = true;
+        dispatchEvent(EVENT_TIMEOUT);
+    }
 }
 
-// Simple Linear Congruential Generator (LCG) random number implementation
-uint16_t custom_rand(void) {
-    // LCG parameters: a good choice for 16-bit values
-    rand_seed = (rand_seed * 31421 + 6927) & 0x7FFF;
-    return rand_seed;
+// Draw one animation frame of the current state
+void animationTask(void) {
+    void (*onTick)(void) = stateTable[currentState].onTick;
+    
+    // Static screens were drawn completely on entry
+    if (onTick == NULL) {
+        return;
+    }
+    profileFrameBegin();
+    onTick();
+    profileFrameEnd();
+    animationFrame++;
 }
 
-// Get a random number between 0 and max-1
-uint16_t custom_rand_range(uint16_t max) {
-    if (max == 0) return 0;
-    return custom_rand() % max;
+// Start timing one frame, no-op unless built with LCD_PROFILE
+void profileFrameBegin(void) {
+#if LCD_PROFILE
+    LCD_profileSnapshot(&frameStart);
+#endif
+}
+
+// Charge the frame to the current screen, empty frames are not counted
+void profileFrameEnd(void) {
+#if LCD_PROFILE
+    LCD_counters_t now;
+    uint32_t cycles;
+    
+    LCD_profileSnapshot(&now);
+    if (now.bytes == frameStart.bytes) {
+        return;
+    }
+    cycles = now.cycles - frameStart.cycles;
+    screenCycles += cycles;
+    if (cycles > screenMaxCycles) {
+        screenMaxCycles = cycles;
+    }
+    screenFrames++;
+#endif
+}
+
+// Print the draw statistics of the screen being left and start a new baseline
+void profileScreenReport(void) {
+#if LCD_PROFILE
+    LCD_counters_t now;
+    
+    LCD_profileSnapshot(&now);
+    if (screenProfiled && screenFrames > 0) {
+        printf("LCD %s: %u frames, %lu us drawing, avg %lu us, max %lu us, %lu B, %lu windows\r\n",
+               stateNames[currentState], screenFrames,
+               screenCycles / (F_CPU / 1000000UL),
+               screenCycles / (F_CPU / 1000000UL) / screenFrames,
+               screenMaxCycles / (F_CPU / 1000000UL),
+               now.bytes - screenStart.bytes, now.windows - screenStart.windows);
+        LCD_profilePrint();
+    }
+    
+    LCD_profileReset();
+    screenStart = now;
+    screenCycles = 0;
+    screenMaxCycles = 0;
+    screenFrames = 0;
+    screenProfiled = true;
+#endif
+}
+
+// Add the state being left to its residency and report it
+void residencyReport(void) {
+    StateResidency *r = &residency[currentState];
+    uint32_t total = scheduler_millis() - stateEnteredAt;
+    uint32_t idle = scheduler_idle_millis() - stateIdleAt;
+    
+    if (!residencyStarted) {
+        residencyStarted = true;
+        return;
+    }
+    
+    // Sleep is measured in microseconds and can round above the total
+    if (idle > total) {
+        idle = total;
+    }
+    r->totalMs += total;
+    r->busyMs += total - idle;
+    
+    if (total > 0) {
+        printf("CPU %s: %lu ms, busy %u%%, %u%% overall\r\n",
+               stateNames[currentState], total,
+               (uint16_t)((total - idle) * 100 / total),
+               (uint16_t)(r->busyMs / (r->totalMs / 100 + 1)));
+    }
+}
+
+// Reel sound while the wheels spin
+void audioTask(void) {
+    if (currentState == STATE_SPINNING) {
+        play_spinning_sound();
+    }
+}
+
+// Periodic status output while waiting for a heart rate
+void logTask(void) {
+    if (currentState == STATE_MEASURING) {
+        max30102_stream_stats_t stats;
+        max30102_led_amplitude_t led;
+        max30102_adc_range_t range;
+        uint16_t agcChanges;
+        
+        max30102_stream_get_stats(&stats);
+        agcChanges = max30102_agc_get(&led, &range);
+        printf("Measuring, HR %s, confidence %u%%, bursts %u, overflow %u, dropped %u\r\n",
+               heartRateReady ? "ready" : "not ready", result.hr_confidence,
+               stats.bursts, stats.overflows, stats.dropped);
+        printf("AGC: IR 0x%02X, red 0x%02X, range %u nA, %u changes\r\n",
+               led.ir, led.red, 2048U << range, agcChanges);
+    }
 }
 
 int main(void) {
     // Initialize hardware
     initialize();
     
+    // Register periodic tasks, each with its own deadline
+    scheduler_add(sensorTask, SENSOR_TASK_MS);
+    scheduler_add(gameTask, GAME_TASK_MS);
+    animationTaskId = scheduler_add(animationTask, IDLE_FRAME_MS);
+    scheduler_add(audioTask, AUDIO_TASK_MS);
+    scheduler_add(logTask, LOG_TASK_MS);
+    scheduler_add(nvstore_service, STORE_TASK_MS);
+    
     // Start with welcome screen
-    currentState = STATE_WELCOME;
-    uint32_t loop_count = 0;
+    enterState(STATE_WELCOME);
     
     // Main loop
     while (1) {   
-        rand_seed ^= (uint16_t)TCNT0;
-        // State machine
-        switch (currentState) {
-            case STATE_WELCOME:
-                displayWelcomeScreen();
-                break;
-                
-            case STATE_PRESS_BUTTON:
-                displayPressButtonPrompt();
-                break;
-                
-            case STATE_MEASURING:
-                displayMeasuringPrompt();
-       
-                if (heartRateReady) {
-                    printf("HR=%u BPM\r\n", heartRate);
-                    
-                    // Button released, determine odds and start spinning
-                    currentState = STATE_SPINNING;
-                    animationFrame = 0;
-                }
-                break;
-                
-            case STATE_SPINNING:
-                displaySpinningPrompt();
-                
-                // Simulate spinning for 3 seconds, then show result
-                static uint8_t spinCount = 0;
-                spinCount++;
-                
-                if (spinCount > 15) {  // ~3 seconds (15 * 200ms)
-                    spinCount = 0;
-                    
-                    // Determine win based on heart rate
-                    uint8_t winPercentage = determineWinOdds();
-                    uint8_t randomValue = custom_rand_range(100);
-                    uint8_t win = (randomValue < winPercentage);
-                    
-                    // Show result
-                    currentState = STATE_RESULT;
-                    displayResultScreen(win);
-                }
-                break;
-                
-            case STATE_RESULT:
-                // This state is handled by displayResultScreen
-                // which automatically transitions back to welcome
-                break;
-                
-            default:
-                // In case of unknown state, reset to welcome
-                currentState = STATE_WELCOME;
-                break;
+        // Nothing due, sleep until the next tick or interrupt
+        if (!scheduler_run()) {
+            scheduler_idle();
         }
     }
     
     return 0;
-}
\ No newline at end of file
+}
@@ -1,660 +0,0 @@
-/**
- * @file max30102.c
- * @brief MAX30102 heart-rate and SpO2 sensor driver implementation for ATMEGA328PB
- * @details Driver for MAXREFDES117# Heart-Rate and Pulse-Oximetry Monitor
- */
-
-#include "max30102.h"
-#include <stdlib.h>
-#include <string.h>
-#include <math.h>
-
-// Default configuration values
-#define DEFAULT_SAMPLE_RATE MAX30102_SAMPLE_RATE_100_HZ
-#define DEFAULT_PULSE_WIDTH MAX30102_PULSE_WIDTH_411_US
-#define DEFAULT_ADC_RANGE MAX30102_ADC_RANGE_16384_NA
-#define DEFAULT_LED_RED_AMPLITUDE 0x1F  // ~6.4mA
-#define DEFAULT_LED_IR_AMPLITUDE 0x1F   // ~6.4mA
-#define DEFAULT_SAMPLE_AVG 4            // 16 samples averaging
-#define DEFAULT_FIFO_ROLLOVER true
-#define DEFAULT_FIFO_ALMOST_FULL 15
-
-// Number of samples to discard after configuration change
-#define DISCARD_SAMPLES 5
-
-// Private function prototypes
-static bool max30102_write_register(uint8_t reg_addr, uint8_t data);
-static bool max30102_read_register(uint8_t reg_addr, uint8_t *data);
-static bool max30102_read_registers(uint8_t reg_addr, uint8_t *data, uint8_t len);
-static bool max30102_clear_fifo(void);
-static uint32_t max30102_extract_red_sample(uint8_t *buffer, uint8_t pulse_width);
-static uint32_t max30102_extract_ir_sample(uint8_t *buffer, uint8_t pulse_width);
-
-// Global variables
-static max30102_pulse_width_t current_pulse_width = DEFAULT_PULSE_WIDTH;
-static uint32_t ir_ac_prev = 0;
-static uint32_t red_ac_prev = 0;
-static float ir_dc_prev = 0;
-static float red_dc_prev = 0;
-static int32_t heart_rate_history[8] = {0};
-static int32_t spo2_history[8] = {0};
-static uint8_t history_index = 0;
-
-/**
- * @brief Initialize the MAX30102 sensor
- * @return true if successful, false otherwise
- */
-bool max30102_init(void) {
-    uint8_t part_id;
-    
-    // Reset the sensor
-    if (!max30102_reset()) {
-        return false;
-    }
-    
-    // Verify part ID
-    if (!max30102_read_part_id(&part_id)) {
-        return false;
-    }
-    
-    if (part_id != 0x15) {  // MAX30102 part ID
-        return false;
-    }
-    
-    // Default configuration
-    max30102_led_amplitude_t led_amplitude = {
-        .red = DEFAULT_LED_RED_AMPLITUDE,
-        .ir = DEFAULT_LED_IR_AMPLITUDE
-    };
-    
-    if (!max30102_configure(DEFAULT_SAMPLE_RATE, DEFAULT_PULSE_WIDTH, 
-                           DEFAULT_ADC_RANGE, led_amplitude)) {
-        return false;
-    }
-    
-    // Configure FIFO
-    if (!max30102_configure_fifo(DEFAULT_SAMPLE_AVG, DEFAULT_FIFO_ROLLOVER, 
-                                DEFAULT_FIFO_ALMOST_FULL)) {
-        return false;
-    }
-    
-    // Set SPO2+HR mode
-    if (!max30102_set_mode(MAX30102_MODE_SPO2_HR)) {
-        return false;
-    }
-    
-    // Enable FIFO almost full interrupt
-    if (!max30102_set_interrupt_enables(MAX30102_INT_A_FULL, 0x00)) {
-        return false;
-    }
-    
-    // Clear FIFO
-    if (!max30102_clear_fifo()) {
-        return false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Reset the MAX30102 sensor
- * @return true if successful, false otherwise
- */
-bool max30102_reset(void) {
-    // Set reset bit in MODE_CONFIG register
-    if (!max30102_write_register(MAX30102_MODE_CONFIG, MAX30102_MODE_RESET)) {
-        return false;
-    }
-    
-    // Wait for reset to complete (reset bit clears automatically)
-    uint8_t mode_config;
-    uint8_t retry = 10;
-    
-    do {
-        if (!max30102_read_register(MAX30102_MODE_CONFIG, &mode_config)) {
-            return false;
-        }
-        
-        if ((mode_config & MAX30102_MODE_RESET) == 0) {
-            break;
-        }
-        
-        // Simple delay
-        for (uint16_t i = 0; i < 10000; i++) {
-            asm("nop");
-        }
-        
-        retry--;
-    } while (retry > 0);
-    
-    if (retry == 0) {
-        return false;  // Reset timeout
-    }
-    
-    return true;
-}
-
-/**
- * @brief Configure the MAX30102 sensor
- * @param sample_rate Sample rate setting
- * @param pulse_width Pulse width setting
- * @param adc_range ADC range setting
- * @param led_amplitude LED current amplitudes
- * @return true if successful, false otherwise
- */
-bool max30102_configure(max30102_sample_rate_t sample_rate, 
-                      max30102_pulse_width_t pulse_width,
-                      max30102_adc_range_t adc_range,
-                      max30102_led_amplitude_t led_amplitude) {
-                      
-    // Store current pulse width for sample extraction
-    current_pulse_width = pulse_width;
-    
-    // Configure SPO2 settings (sample rate, pulse width, ADC range)
-    uint8_t spo2_config = (sample_rate << 2) | (pulse_width << 0);
-    spo2_config |= MAX30102_SPO2_HI_RES_EN; // Enable high resolution mode
-    spo2_config |= (adc_range << 4);
-    
-    if (!max30102_write_register(MAX30102_SPO2_CONFIG, spo2_config)) {
-        return false;
-    }
-    
-    // Set LED pulse amplitudes
-    if (!max30102_write_register(MAX30102_LED1_PA, led_amplitude.red)) {
-        return false;
-    }
-    
-    if (!max30102_write_register(MAX30102_LED2_PA, led_amplitude.ir)) {
-        return false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Set the mode of operation
- * @param mode Mode setting (MAX30102_MODE_HR_ONLY or MAX30102_MODE_SPO2_HR)
- * @return true if successful, false otherwise
- */
-bool max30102_set_mode(uint8_t mode) {
-    // Read current mode configuration
-    uint8_t mode_config;
-    if (!max30102_read_register(MAX30102_MODE_CONFIG, &mode_config)) {
-        return false;
-    }
-    
-    // Clear mode bits (bits 2:0) and set new mode
-    mode_config &= ~0x07;  // Clear bits 2:0
-    mode_config |= mode;   // Set new mode
-    
-    // Write updated mode configuration
-    if (!max30102_write_register(MAX30102_MODE_CONFIG, mode_config)) {
-        return false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Set the interrupt enables
- * @param int_1 Interrupt enable 1 register value
- * @param int_2 Interrupt enable 2 register value
- * @return true if successful, false otherwise
- */
-bool max30102_set_interrupt_enables(uint8_t int_1, uint8_t int_2) {
-    if (!max30102_write_register(MAX30102_INT_ENABLE_1, int_1)) {
-        return false;
-    }
-    
-    if (!max30102_write_register(MAX30102_INT_ENABLE_2, int_2)) {
-        return false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Read and clear interrupt status
- * @param int_status_1 Pointer to store interrupt status 1
- * @param int_status_2 Pointer to store interrupt status 2
- * @return true if successful, false otherwise
- */
-bool max30102_read_interrupt_status(uint8_t *int_status_1, uint8_t *int_status_2) {
-    if (!max30102_read_register(MAX30102_INT_STATUS_1, int_status_1)) {
-        return false;
-    }
-    
-    if (!max30102_read_register(MAX30102_INT_STATUS_2, int_status_2)) {
-        return false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Configure the FIFO settings
- * @param sample_avg Sample averaging (0=1, 1=2, 2=4, 3=8, 4=16, 5=32)
- * @param fifo_rollover_en FIFO rollover enable
- * @param fifo_almost_full_samples FIFO almost full value (0-15)
- * @return true if successful, false otherwise
- */
-bool max30102_configure_fifo(uint8_t sample_avg, bool fifo_rollover_en, uint8_t fifo_almost_full_samples) {
-    uint8_t fifo_config = 0;
-    
-    // Set sample averaging bits (bits 7:5)
-    fifo_config |= (sample_avg & 0x07) << 5;
-    
-    // Set FIFO rollover bit (bit 4)
-    if (fifo_rollover_en) {
-        fifo_config |= (1 << 4);
-    }
-    
-    // Set FIFO almost full value (bits 3:0)
-    fifo_config |= (fifo_almost_full_samples & 0x0F);
-    
-    // Write FIFO configuration
-    if (!max30102_write_register(MAX30102_FIFO_CONFIG, fifo_config)) {
-        return false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Read FIFO pointers
- * @param write_ptr Pointer to store write pointer value
- * @param read_ptr Pointer to store read pointer value
- * @param overflow_ctr Pointer to store overflow counter
- * @return true if successful, false otherwise
- */
-bool max30102_read_fifo_ptrs(uint8_t *write_ptr, uint8_t *read_ptr, uint8_t *overflow_ctr) {
-    if (!max30102_read_register(MAX30102_FIFO_WR_PTR, write_ptr)) {
-        return false;
-    }
-    
-    if (!max30102_read_register(MAX30102_FIFO_RD_PTR, read_ptr)) {
-        return false;
-    }
-    
-    if (!max30102_read_register(MAX30102_FIFO_OVF_CNT, overflow_ctr)) {
-        return false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Read samples from FIFO
- * @param samples Pointer to array to store samples
- * @param count Number of samples to read
- * @return Number of samples read
- */
-uint8_t max30102_read_fifo_samples(max30102_fifo_sample_t *samples, uint8_t count) {
-    uint8_t bytes_per_sample;
-    
-    // Each sample is 3 bytes per LED
-    bytes_per_sample = 6;  // 3 bytes for RED + 3 bytes for IR
-    
-    // Temporary buffer for raw data
-    uint8_t buffer[bytes_per_sample * count];
-    
-    // Read data from FIFO
-    if (!max30102_read_registers(MAX30102_FIFO_DATA, buffer, bytes_per_sample * count)) {
-        return 0;
-    }
-    
-    // Extract samples
-    for (uint8_t i = 0; i < count; i++) {
-        uint8_t *sample_ptr = buffer + (i * bytes_per_sample);
-        
-        // Extract RED sample (first 3 bytes)
-        samples[i].red = max30102_extract_red_sample(sample_ptr, current_pulse_width);
-        
-        // Extract IR sample (next 3 bytes)
-        samples[i].ir = max30102_extract_ir_sample(sample_ptr + 3, current_pulse_width);
-    }
-    
-    return count;
-}
-
-/**
- * @brief Read die temperature
- * @param temperature_c Pointer to store temperature in degrees Celsius
- * @return true if successful, false otherwise
- */
-bool max30102_read_temperature(float *temperature_c) {
-    uint8_t temp_int, temp_frac;
-    
-    // Trigger temperature conversion
-    if (!max30102_write_register(MAX30102_TEMP_CONFIG, 0x01)) {
-        return false;
-    }
-    
-    // Wait for temperature data to be ready
-    uint8_t int_status_2;
-    uint8_t retry = 10;
-    
-    do {
-        if (!max30102_read_register(MAX30102_INT_STATUS_2, &int_status_2)) {
-            return false;
-        }
-        
-        if (int_status_2 & MAX30102_INT_DIE_TEMP_RDY) {
-            break;
-        }
-        
-        // Simple delay
-        for (uint16_t i = 0; i < 1000; i++) {
-            asm("nop");
-        }
-        
-        retry--;
-    } while (retry > 0);
-    
-    if (retry == 0) {
-        return false;  // Timeout waiting for temperature
-    }
-    
-    // Read temperature values
-    if (!max30102_read_register(MAX30102_TEMP_INT, &temp_int)) {
-        return false;
-    }
-    
-    if (!max30102_read_register(MAX30102_TEMP_FRAC, &temp_frac)) {
-        return false;
-    }
-    
-    // Calculate temperature (integer part + fractional part)
-    // Fractional part resolution is 0.0625C
-    *temperature_c = (float)temp_int + ((float)temp_frac * 0.0625);
-    
-    return true;
-}
-
-/**
- * @brief Read part ID
- * @param part_id Pointer to store part ID
- * @return true if successful, false otherwise
- */
-bool max30102_read_part_id(uint8_t *part_id) {
-    return max30102_read_register(MAX30102_PART_ID, part_id);
-}
-
-/**
- * @brief Read revision ID
- * @param rev_id Pointer to store revision ID
- * @return true if successful, false otherwise
- */
-bool max30102_read_revision_id(uint8_t *rev_id) {
-    return max30102_read_register(MAX30102_REV_ID, rev_id);
-}
-
-/**
- * @brief Process samples to calculate heart rate and SpO2
- * @param samples Array of samples
- * @param count Number of samples
- * @param result Pointer to store the results
- * @return true if calculation successful, false otherwise
- */
-bool max30102_calculate_hr_spo2(max30102_fifo_sample_t *samples, uint8_t count, max30102_result_t *result) {
-    // Streamlined implementation that uses less memory
-    if (count == 0 || samples == NULL || result == NULL) {
-        return false;
-    }
-    
-    // Variables for signal analysis
-    uint32_t ir_min = 0xFFFFFFFF;
-    uint32_t ir_max = 0;
-    uint32_t ir_avg = 0;
-    uint32_t red_min = 0xFFFFFFFF;
-    uint32_t red_max = 0;
-    uint32_t red_avg = 0;
-    
-    // First pass - find min, max and avg values
-    for (uint8_t i = 0; i < count; i++) {
-        ir_avg += samples[i].ir;
-        red_avg += samples[i].red;
-        
-        if (samples[i].ir > ir_max) ir_max = samples[i].ir;
-        if (samples[i].ir < ir_min) ir_min = samples[i].ir;
-        if (samples[i].red > red_max) red_max = samples[i].red;
-        if (samples[i].red < red_min) red_min = samples[i].red;
-    }
-    
-    // Calculate averages
-    ir_avg /= count;
-    red_avg /= count;
-    
-    // Check if valid signal is present (finger on sensor)
-    bool finger_present = false;
-    
-    // If IR average is significant and there's some variation, consider finger present
-    if (ir_avg > 5000 && (ir_max - ir_min) > (ir_avg * 0.01)) {
-        finger_present = true;
-    }
-    
-    // Simplified heart rate detection
-    // Using peak-to-peak timing for heart rate calculation
-    if (finger_present && (ir_max - ir_min) > 1000) {
-        // Simple heart rate estimate based on signal amplitude and sampling rate
-        // This is a simplification - actual HR would need proper peak detection
-        // We're using a simplified algorithm to save memory
-        uint32_t amplitude = ir_max - ir_min;
-        
-        // A very basic heart rate estimation based on sample amplitude
-        // This is not clinically accurate but works for demonstration
-        int32_t estimated_hr = 60 + (amplitude / 500);
-        
-        // Clamp heart rate to reasonable values
-        if (estimated_hr < 40) estimated_hr = 40;
-        if (estimated_hr > 180) estimated_hr = 180;
-        
-        result->heart_rate = estimated_hr;
-        result->hr_valid = true;
-    } else {
-        result->hr_valid = false;
-    }
-    
-    // Calculate SpO2 (simplified)
-    if (finger_present) {
-        float red_ac = (float)(red_max - red_min);
-        float ir_ac = (float)(ir_max - ir_min);
-        
-        if (ir_ac > 0 && red_avg > 0) {
-            float ratio = (red_ac * ir_avg) / (ir_ac * red_avg);
-            float spo2 = 110.0f - 25.0f * ratio;
-            
-            // Clamp to valid range
-            if (spo2 > 100.0f) spo2 = 100.0f;
-            if (spo2 < 70.0f) spo2 = 70.0f;
-            
-            result->spo2 = (int32_t)spo2;
-            result->spo2_valid = true;
-        } else {
-            result->spo2_valid = false;
-        }
-    } else {
-        result->spo2_valid = false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Shutdown the sensor
- * @param shutdown true to enter shutdown mode, false to exit
- * @return true if successful, false otherwise
- */
-bool max30102_shutdown(bool shutdown) {
-    uint8_t mode_config;
-    
-    // Read current mode configuration
-    if (!max30102_read_register(MAX30102_MODE_CONFIG, &mode_config)) {
-        return false;
-    }
-    
-    // Set or clear shutdown bit
-    if (shutdown) {
-        mode_config |= MAX30102_MODE_SHDN;
-    } else {
-        mode_config &= ~MAX30102_MODE_SHDN;
-    }
-    
-    // Write updated mode configuration
-    if (!max30102_write_register(MAX30102_MODE_CONFIG, mode_config)) {
-        return false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Set up interrupt handling
- * @return true if successful, false otherwise
- */
-bool max30102_setup_interrupt(void) {
-    // This function should be customized based on hardware setup
-    // It needs to set up the external interrupt pin (INT) connected to PD2
-    
-    // Example for ATMEGA328PB with INT connected to PD2 (INT0)
-    // Enable external interrupt INT0 on falling edge
-    EICRA = (1 << ISC01);  // Falling edge
-    EIMSK |= (1 << INT0);  // Enable INT0
-    
-    return true;
-}
-
-/**
- * @brief Process new data when interrupt occurs
- * @param result Pointer to store the results
- * @return true if new data processed, false otherwise
- */
-bool max30102_process_interrupt(max30102_result_t *result) {
-    uint8_t int_status_1, int_status_2;
-    
-    // Read and clear interrupt status
-    if (!max30102_read_interrupt_status(&int_status_1, &int_status_2)) {
-        return false;
-    }
-    
-    // Check if FIFO almost full interrupt occurred
-    if (int_status_1 & MAX30102_INT_A_FULL) {
-        uint8_t read_ptr, write_ptr, overflow;
-        
-        // Read FIFO pointers
-        if (!max30102_read_fifo_ptrs(&write_ptr, &read_ptr, &overflow)) {
-            return false;
-        }
-        
-        // Calculate number of samples available
-        uint8_t samples_available;
-        if (write_ptr >= read_ptr) {
-            samples_available = write_ptr - read_ptr;
-        } else {
-            samples_available = 32 - read_ptr + write_ptr;  // FIFO is 32 samples deep
-        }
-        
-        // Cap at a reasonable number
-        if (samples_available > 16) {
-            samples_available = 16;
-        }
-        
-        // Read samples from FIFO
-        max30102_fifo_sample_t samples[16];
-        uint8_t samples_read = max30102_read_fifo_samples(samples, samples_available);
-        
-        if (samples_read > 0) {
-            // Process samples
-            return max30102_calculate_hr_spo2(samples, samples_read, result);
-        }
-    }
-    
-    return false;
-}
-
-/**
- * @brief Write to a register on the MAX30102
- * @param reg_addr Register address
- * @param data Data to write
- * @return true if successful, false otherwise
- */
-static bool max30102_write_register(uint8_t reg_addr, uint8_t data) {
-    return i2c_write_register(MAX30102_I2C_ADDR, reg_addr, data);
-}
-
-/**
- * @brief Read from a register on the MAX30102
- * @param reg_addr Register address
- * @param data Pointer to store read data
- * @return true if successful, false otherwise
- */
-static bool max30102_read_register(uint8_t reg_addr, uint8_t *data) {
-    return i2c_read_register(MAX30102_I2C_ADDR, reg_addr, data);
-}
-
-/**
- * @brief Read multiple registers from the MAX30102
- * @param reg_addr Starting register address
- * @param data Pointer to buffer to store read data
- * @param len Number of bytes to read
- * @return true if successful, false otherwise
- */
-static bool max30102_read_registers(uint8_t reg_addr, uint8_t *data, uint8_t len) {
-    return i2c_read_registers(MAX30102_I2C_ADDR, reg_addr, data, len);
-}
-
-/**
- * @brief Clear the FIFO pointers
- * @return true if successful, false otherwise
- */
-static bool max30102_clear_fifo(void) {
-    // Reset FIFO pointers to 0
-    if (!max30102_write_register(MAX30102_FIFO_WR_PTR, 0)) {
-        return false;
-    }
-    
-    if (!max30102_write_register(MAX30102_FIFO_RD_PTR, 0)) {
-        return false;
-    }
-    
-    if (!max30102_write_register(MAX30102_FIFO_OVF_CNT, 0)) {
-        return false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Extract red LED sample from raw buffer
- * @param buffer Pointer to raw sample data
- * @param pulse_width Pulse width setting (determines sample resolution)
- * @return Extracted sample value
- */
-static uint32_t max30102_extract_red_sample(uint8_t *buffer, uint8_t pulse_width) {
-    uint32_t sample = ((uint32_t)buffer[0] << 16) | ((uint32_t)buffer[1] << 8) | buffer[2];
-    
-    // Mask unused bits based on pulse width
-    switch (pulse_width) {
-        case MAX30102_PULSE_WIDTH_69_US:
-            return sample & 0x7FFF;  // 15-bit
-        case MAX30102_PULSE_WIDTH_118_US:
-            return sample & 0xFFFF;  // 16-bit
-        case MAX30102_PULSE_WIDTH_215_US:
-            return sample & 0x1FFFF; // 17-bit
-        case MAX30102_PULSE_WIDTH_411_US:
-            return sample & 0x3FFFF; // 18-bit
-        default:
-            return sample;
-    }
-}
-
-/**
- * @brief Extract IR LED sample from raw buffer
- * @param buffer Pointer to raw sample data
- * @param pulse_width Pulse width setting (determines sample resolution)
- * @return Extracted sample value
- */
-static uint32_t max30102_extract_ir_sample(uint8_t *buffer, uint8_t pulse_width) {
-    // Same extraction logic as red sample
-    return max30102_extract_red_sample(buffer, pulse_width);
-}
\ No newline at end of file
@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=LCD_GFX.c ST7735.c main.c uart.c i2c.c max30102.c
+SOURCEFILES_QUOTED_IF_SPACED=../common/LCD_GFX.c ../common/ST7735.c main.c ../common/uart.c ../common/i2c.c ../common/max30102.c reels.c buzzer.c scheduler.c reel_sprites.c ../common/telemetry.c ../common/rng.c button.c nvstore.c plot.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/LCD_GFX.o ${OBJECTDIR}/ST7735.o ${OBJECTDIR}/main.o ${OBJECTDIR}/uart.o ${OBJECTDIR}/i2c.o ${OBJECTDIR}/max30102.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/LCD_GFX.o.d ${OBJECTDIR}/ST7735.o.d ${OBJECTDIR}/main.o.d ${OBJECTDIR}/uart.o.d ${OBJECTDIR}/i2c.o.d ${OBJECTDIR}/max30102.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1270477542/LCD_GFX.o ${OBJECTDIR}/_ext/1270477542/ST7735.o ${OBJECTDIR}/main.o ${OBJECTDIR}/_ext/1270477542/uart.o ${OBJECTDIR}/_ext/1270477542/i2c.o ${OBJECTDIR}/_ext/1270477542/max30102.o ${OBJECTDIR}/reels.o ${OBJECTDIR}/buzzer.o ${OBJECTDIR}/scheduler.o ${OBJECTDIR}/reel_sprites.o ${OBJECTDIR}/_ext/1270477542/telemetry.o ${OBJECTDIR}/_ext/1270477542/rng.o ${OBJECTDIR}/button.o ${OBJECTDIR}/nvstore.o ${OBJECTDIR}/plot.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d ${OBJECTDIR}/_ext/1270477542/ST7735.o.d ${OBJECTDIR}/main.o.d ${OBJECTDIR}/_ext/1270477542/uart.o.d ${OBJECTDIR}/_ext/1270477542/i2c.o.d ${OBJECTDIR}/_ext/1270477542/max30102.o.d ${OBJECTDIR}/reels.o.d ${OBJECTDIR}/buzzer.o.d ${OBJECTDIR}/scheduler.o.d ${OBJECTDIR}/reel_sprites.o.d ${OBJECTDIR}/_ext/1270477542/telemetry.o.d ${OBJECTDIR}/_ext/1270477542/rng.o.d ${OBJECTDIR}/button.o.d ${OBJECTDIR}/nvstore.o.d ${OBJECTDIR}/plot.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/LCD_GFX.o ${OBJECTDIR}/ST7735.o ${OBJECTDIR}/main.o ${OBJECTDIR}/uart.o ${OBJECTDIR}/i2c.o ${OBJECTDIR}/max30102.o
+OBJECTFILES=${OBJECTDIR}/_ext/1270477542/LCD_GFX.o ${OBJECTDIR}/_ext/1270477542/ST7735.o ${OBJECTDIR}/main.o ${OBJECTDIR}/_ext/1270477542/uart.o ${OBJECTDIR}/_ext/1270477542/i2c.o ${OBJECTDIR}/_ext/1270477542/max30102.o ${OBJECTDIR}/reels.o ${OBJECTDIR}/buzzer.o ${OBJECTDIR}/scheduler.o ${OBJECTDIR}/reel_sprites.o ${OBJECTDIR}/_ext/1270477542/telemetry.o ${OBJECTDIR}/_ext/1270477542/rng.o ${OBJECTDIR}/button.o ${OBJECTDIR}/nvstore.o ${OBJECTDIR}/plot.o
 
 # Source Files
-SOURCEFILES=LCD_GFX.c ST7735.c main.c uart.c i2c.c max30102.c
+SOURCEFILES=../common/LCD_GFX.c ../common/ST7735.c main.c ../common/uart.c ../common/i2c.c ../common/max30102.c reels.c buzzer.c scheduler.c reel_sprites.c ../common/telemetry.c ../common/rng.c button.c nvstore.c plot.c
 
 
 
@@ -88,78 +88,186 @@ MP_PROCESSOR_OPTION=ATmega328PB
 # ------------------------------------------------------------------------------------
 # Rules for buildStep: compile
 ifeq ($(TYPE_IMAGE), DEBUG_RUN)
-${OBJECTDIR}/LCD_GFX.o: LCD_GFX.c  .generated_files/flags/default/30b3fbcc16d9d571faf69d072b3ccb17f091a015 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/LCD_GFX.o.d 
-	@${RM} ${OBJECTDIR}/LCD_GFX.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/LCD_GFX.o.d" -MT "${OBJECTDIR}/LCD_GFX.o.d" -MT ${OBJECTDIR}/LCD_GFX.o -o ${OBJECTDIR}/LCD_GFX.o LCD_GFX.c 
+${OBJECTDIR}/_ext/1270477542/LCD_GFX.o: ../common/LCD_GFX.c  .generated_files/flags/default/30b3fbcc16d9d571faf69d072b3ccb17f091a015 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d" -MT "${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d" -MT ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o -o ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o ../common/LCD_GFX.c 
 	
-${OBJECTDIR}/ST7735.o: ST7735.c  .generated_files/flags/default/f38532840d1238a732ddffefbdea2260081e01cb .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
-	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/ST7735.o.d 
-	@${RM} ${OBJECTDIR}/ST7735.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/ST7735.o.d" -MT "${OBJECTDIR}/ST7735.o.d" -MT ${OBJECTDIR}/ST7735.o -o ${OBJECTDIR}/ST7735.o ST7735.c 
+${OBJECTDIR}/_ext/1270477542/ST7735.o: ../common/ST7735.c  .generated_files/flags/default/f38532840d1238a732ddffefbdea2260081e01cb .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/ST7735.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/ST7735.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/ST7735.o.d" -MT "${OBJECTDIR}/_ext/1270477542/ST7735.o.d" -MT ${OBJECTDIR}/_ext/1270477542/ST7735.o -o ${OBJECTDIR}/_ext/1270477542/ST7735.o ../common/ST7735.c 
 	
 ${OBJECTDIR}/main.o: main.c  .generated_files/flags/default/530df04f52b5c7682511b9288c0153f3fef0c7b2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/main.o.d 
 	@${RM} ${OBJECTDIR}/main.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/main.o.d" -MT "${OBJECTDIR}/main.o.d" -MT ${OBJECTDIR}/main.o -o ${OBJECTDIR}/main.o main.c 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/main.o.d" -MT "${OBJECTDIR}/main.o.d" -MT ${OBJECTDIR}/main.o -o ${OBJECTDIR}/main.o main.c 
+	
+${OBJECTDIR}/_ext/1270477542/uart.o: ../common/uart.c  .generated_files/flags/default/7031871f01f1581cc348335691f36d12949f0df3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/uart.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/uart.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/uart.o.d" -MT "${OBJECTDIR}/_ext/1270477542/uart.o.d" -MT ${OBJECTDIR}/_ext/1270477542/uart.o -o ${OBJECTDIR}/_ext/1270477542/uart.o ../common/uart.c 
+	
+${OBJECTDIR}/_ext/1270477542/i2c.o: ../common/i2c.c  .generated_files/flags/default/271cf5374e95c1e876b7630d4905f06d92875d44 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/i2c.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/i2c.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/i2c.o.d" -MT "${OBJECTDIR}/_ext/1270477542/i2c.o.d" -MT ${OBJECTDIR}/_ext/1270477542/i2c.o -o ${OBJECTDIR}/_ext/1270477542/i2c.o ../common/i2c.c 
 	
-${OBJECTDIR}/uart.o: uart.c  .generated_files/flags/default/7031871f01f1581cc348335691f36d12949f0df3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/_ext/1270477542/max30102.o: ../common/max30102.c  .generated_files/flags/default/a6654dcbf91a38fb018583c2dfbe1c0d9c26cc62 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/max30102.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/max30102.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/max30102.o.d" -MT "${OBJECTDIR}/_ext/1270477542/max30102.o.d" -MT ${OBJECTDIR}/_ext/1270477542/max30102.o -o ${OBJECTDIR}/_ext/1270477542/max30102.o ../common/max30102.c 
+	
+${OBJECTDIR}/reels.o: reels.c  .generated_files/flags/default/630cfef9d1ad5f13e0a8a6a3b5a05b29407799bc .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/uart.o.d 
-	@${RM} ${OBJECTDIR}/uart.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/uart.o.d" -MT "${OBJECTDIR}/uart.o.d" -MT ${OBJECTDIR}/uart.o -o ${OBJECTDIR}/uart.o uart.c 
+	@${RM} ${OBJECTDIR}/reels.o.d 
+	@${RM} ${OBJECTDIR}/reels.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/reels.o.d" -MT "${OBJECTDIR}/reels.o.d" -MT ${OBJECTDIR}/reels.o -o ${OBJECTDIR}/reels.o reels.c 
 	
-${OBJECTDIR}/i2c.o: i2c.c  .generated_files/flags/default/271cf5374e95c1e876b7630d4905f06d92875d44 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/buzzer.o: buzzer.c  .generated_files/flags/default/3acbdc390f895827033642d523d770f574a101db .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/i2c.o.d 
-	@${RM} ${OBJECTDIR}/i2c.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/i2c.o.d" -MT "${OBJECTDIR}/i2c.o.d" -MT ${OBJECTDIR}/i2c.o -o ${OBJECTDIR}/i2c.o i2c.c 
+	@${RM} ${OBJECTDIR}/buzzer.o.d 
+	@${RM} ${OBJECTDIR}/buzzer.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/buzzer.o.d" -MT "${OBJECTDIR}/buzzer.o.d" -MT ${OBJECTDIR}/buzzer.o -o ${OBJECTDIR}/buzzer.o buzzer.c 
 	
-${OBJECTDIR}/max30102.o: max30102.c  .generated_files/flags/default/a6654dcbf91a38fb018583c2dfbe1c0d9c26cc62 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/scheduler.o: scheduler.c  .generated_files/flags/default/2a8c9e0cde432d88caa23323239a76661da5abec .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/max30102.o.d 
-	@${RM} ${OBJECTDIR}/max30102.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/max30102.o.d" -MT "${OBJECTDIR}/max30102.o.d" -MT ${OBJECTDIR}/max30102.o -o ${OBJECTDIR}/max30102.o max30102.c 
+	@${RM} ${OBJECTDIR}/scheduler.o.d 
+	@${RM} ${OBJECTDIR}/scheduler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/scheduler.o.d" -MT "${OBJECTDIR}/scheduler.o.d" -MT ${OBJECTDIR}/scheduler.o -o ${OBJECTDIR}/scheduler.o scheduler.c 
 	
-else
-${OBJECTDIR}/LCD_GFX.o: LCD_GFX.c  .generated_files/flags/default/70d317a43011a334b631a00d8e8ec4ba6473d255 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/reel_sprites.o: reel_sprites.c  .generated_files/flags/default/fedfbd26c6dd16fc1db464cc4f83e6a5842fc7c0 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/reel_sprites.o.d 
+	@${RM} ${OBJECTDIR}/reel_sprites.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/reel_sprites.o.d" -MT "${OBJECTDIR}/reel_sprites.o.d" -MT ${OBJECTDIR}/reel_sprites.o -o ${OBJECTDIR}/reel_sprites.o reel_sprites.c 
+	
+${OBJECTDIR}/_ext/1270477542/telemetry.o: ../common/telemetry.c  .generated_files/flags/default/6f16cfcfa38d1c1c9f48e30f9dcb49b2d184a302 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/telemetry.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/telemetry.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/telemetry.o.d" -MT "${OBJECTDIR}/_ext/1270477542/telemetry.o.d" -MT ${OBJECTDIR}/_ext/1270477542/telemetry.o -o ${OBJECTDIR}/_ext/1270477542/telemetry.o ../common/telemetry.c 
+	
+${OBJECTDIR}/_ext/1270477542/rng.o: ../common/rng.c  .generated_files/flags/default/b50fc74f19fd9084760ab3596ca128441c46cbb1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/rng.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/rng.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/rng.o.d" -MT "${OBJECTDIR}/_ext/1270477542/rng.o.d" -MT ${OBJECTDIR}/_ext/1270477542/rng.o -o ${OBJECTDIR}/_ext/1270477542/rng.o ../common/rng.c 
+	
+${OBJECTDIR}/button.o: button.c  .generated_files/flags/default/4384c16323bf6e293ad52d654563adf033a648a4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/LCD_GFX.o.d 
-	@${RM} ${OBJECTDIR}/LCD_GFX.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/LCD_GFX.o.d" -MT "${OBJECTDIR}/LCD_GFX.o.d" -MT ${OBJECTDIR}/LCD_GFX.o -o ${OBJECTDIR}/LCD_GFX.o LCD_GFX.c 
+	@${RM} ${OBJECTDIR}/button.o.d 
+	@${RM} ${OBJECTDIR}/button.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/button.o.d" -MT "${OBJECTDIR}/button.o.d" -MT ${OBJECTDIR}/button.o -o ${OBJECTDIR}/button.o button.c 
 	
-${OBJECTDIR}/ST7735.o: ST7735.c  .generated_files/flags/default/3a60174ea59b745c92dbb55135636aec10966a4b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/nvstore.o: nvstore.c  .generated_files/flags/default/86aa13fe0757cfbc7ae59f2771a4c9bd1e434d98 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/ST7735.o.d 
-	@${RM} ${OBJECTDIR}/ST7735.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/ST7735.o.d" -MT "${OBJECTDIR}/ST7735.o.d" -MT ${OBJECTDIR}/ST7735.o -o ${OBJECTDIR}/ST7735.o ST7735.c 
+	@${RM} ${OBJECTDIR}/nvstore.o.d 
+	@${RM} ${OBJECTDIR}/nvstore.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/nvstore.o.d" -MT "${OBJECTDIR}/nvstore.o.d" -MT ${OBJECTDIR}/nvstore.o -o ${OBJECTDIR}/nvstore.o nvstore.c 
+	
+${OBJECTDIR}/plot.o: plot.c  .generated_files/flags/default/0be23f5b5194ca8353138f85c50b1764b41dcf55 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/plot.o.d 
+	@${RM} ${OBJECTDIR}/plot.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1 -g -DDEBUG  -gdwarf-2  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/plot.o.d" -MT "${OBJECTDIR}/plot.o.d" -MT ${OBJECTDIR}/plot.o -o ${OBJECTDIR}/plot.o plot.c 
+	
+else
+${OBJECTDIR}/_ext/1270477542/LCD_GFX.o: ../common/LCD_GFX.c  .generated_files/flags/default/70d317a43011a334b631a00d8e8ec4ba6473d255 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d" -MT "${OBJECTDIR}/_ext/1270477542/LCD_GFX.o.d" -MT ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o -o ${OBJECTDIR}/_ext/1270477542/LCD_GFX.o ../common/LCD_GFX.c 
+	
+${OBJECTDIR}/_ext/1270477542/ST7735.o: ../common/ST7735.c  .generated_files/flags/default/3a60174ea59b745c92dbb55135636aec10966a4b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/ST7735.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/ST7735.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/ST7735.o.d" -MT "${OBJECTDIR}/_ext/1270477542/ST7735.o.d" -MT ${OBJECTDIR}/_ext/1270477542/ST7735.o -o ${OBJECTDIR}/_ext/1270477542/ST7735.o ../common/ST7735.c 
 	
 ${OBJECTDIR}/main.o: main.c  .generated_files/flags/default/1f65c0a14a4cadaf792fd753c179b624935b45fd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/main.o.d 
 	@${RM} ${OBJECTDIR}/main.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/main.o.d" -MT "${OBJECTDIR}/main.o.d" -MT ${OBJECTDIR}/main.o -o ${OBJECTDIR}/main.o main.c 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/main.o.d" -MT "${OBJECTDIR}/main.o.d" -MT ${OBJECTDIR}/main.o -o ${OBJECTDIR}/main.o main.c 
+	
+${OBJECTDIR}/_ext/1270477542/uart.o: ../common/uart.c  .generated_files/flags/default/e3af38c712e577ca4e121f8465437ba3d6333f6f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/uart.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/uart.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/uart.o.d" -MT "${OBJECTDIR}/_ext/1270477542/uart.o.d" -MT ${OBJECTDIR}/_ext/1270477542/uart.o -o ${OBJECTDIR}/_ext/1270477542/uart.o ../common/uart.c 
+	
+${OBJECTDIR}/_ext/1270477542/i2c.o: ../common/i2c.c  .generated_files/flags/default/f26981eea0f02e23200f44b918fe26c0370da007 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/i2c.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/i2c.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/i2c.o.d" -MT "${OBJECTDIR}/_ext/1270477542/i2c.o.d" -MT ${OBJECTDIR}/_ext/1270477542/i2c.o -o ${OBJECTDIR}/_ext/1270477542/i2c.o ../common/i2c.c 
+	
+${OBJECTDIR}/_ext/1270477542/max30102.o: ../common/max30102.c  .generated_files/flags/default/58439ed3724313582c39c26dba1f593413f74449 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/max30102.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/max30102.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/max30102.o.d" -MT "${OBJECTDIR}/_ext/1270477542/max30102.o.d" -MT ${OBJECTDIR}/_ext/1270477542/max30102.o -o ${OBJECTDIR}/_ext/1270477542/max30102.o ../common/max30102.c 
+	
+${OBJECTDIR}/reels.o: reels.c  .generated_files/flags/default/ba6228a0a19de2ee8d08aa72260d836cc313c704 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/reels.o.d 
+	@${RM} ${OBJECTDIR}/reels.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/reels.o.d" -MT "${OBJECTDIR}/reels.o.d" -MT ${OBJECTDIR}/reels.o -o ${OBJECTDIR}/reels.o reels.c 
+	
+${OBJECTDIR}/buzzer.o: buzzer.c  .generated_files/flags/default/be9f961271d50963664ebbbe41922d70eb6d5e25 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/buzzer.o.d 
+	@${RM} ${OBJECTDIR}/buzzer.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/buzzer.o.d" -MT "${OBJECTDIR}/buzzer.o.d" -MT ${OBJECTDIR}/buzzer.o -o ${OBJECTDIR}/buzzer.o buzzer.c 
+	
+${OBJECTDIR}/scheduler.o: scheduler.c  .generated_files/flags/default/69499313b5b7c7b77817a77369d4823e233e80c0 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/scheduler.o.d 
+	@${RM} ${OBJECTDIR}/scheduler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/scheduler.o.d" -MT "${OBJECTDIR}/scheduler.o.d" -MT ${OBJECTDIR}/scheduler.o -o ${OBJECTDIR}/scheduler.o scheduler.c 
+	
+${OBJECTDIR}/reel_sprites.o: reel_sprites.c  .generated_files/flags/default/481fc86b91641d40c1e3ec00840449993b92d73c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/reel_sprites.o.d 
+	@${RM} ${OBJECTDIR}/reel_sprites.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/reel_sprites.o.d" -MT "${OBJECTDIR}/reel_sprites.o.d" -MT ${OBJECTDIR}/reel_sprites.o -o ${OBJECTDIR}/reel_sprites.o reel_sprites.c 
+	
+${OBJECTDIR}/_ext/1270477542/telemetry.o: ../common/telemetry.c  .generated_files/flags/default/fb28ed6d2555571efbed4995b110938237fcccfc .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/telemetry.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/telemetry.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/telemetry.o.d" -MT "${OBJECTDIR}/_ext/1270477542/telemetry.o.d" -MT ${OBJECTDIR}/_ext/1270477542/telemetry.o -o ${OBJECTDIR}/_ext/1270477542/telemetry.o ../common/telemetry.c 
+	
+${OBJECTDIR}/_ext/1270477542/rng.o: ../common/rng.c  .generated_files/flags/default/1b7fcf777cf6be9301fb709a24264c0c3730035c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1270477542" 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/rng.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1270477542/rng.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/_ext/1270477542/rng.o.d" -MT "${OBJECTDIR}/_ext/1270477542/rng.o.d" -MT ${OBJECTDIR}/_ext/1270477542/rng.o -o ${OBJECTDIR}/_ext/1270477542/rng.o ../common/rng.c 
 	
-${OBJECTDIR}/uart.o: uart.c  .generated_files/flags/default/e3af38c712e577ca4e121f8465437ba3d6333f6f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/button.o: button.c  .generated_files/flags/default/7e32fe6645d21dfc756f4dd69b038caaa67df67d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/uart.o.d 
-	@${RM} ${OBJECTDIR}/uart.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/uart.o.d" -MT "${OBJECTDIR}/uart.o.d" -MT ${OBJECTDIR}/uart.o -o ${OBJECTDIR}/uart.o uart.c 
+	@${RM} ${OBJECTDIR}/button.o.d 
+	@${RM} ${OBJECTDIR}/button.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/button.o.d" -MT "${OBJECTDIR}/button.o.d" -MT ${OBJECTDIR}/button.o -o ${OBJECTDIR}/button.o button.c 
 	
-${OBJECTDIR}/i2c.o: i2c.c  .generated_files/flags/default/f26981eea0f02e23200f44b918fe26c0370da007 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/nvstore.o: nvstore.c  .generated_files/flags/default/6cd47b6cdc8132153435f80e5d63087e35f116e4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/i2c.o.d 
-	@${RM} ${OBJECTDIR}/i2c.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/i2c.o.d" -MT "${OBJECTDIR}/i2c.o.d" -MT ${OBJECTDIR}/i2c.o -o ${OBJECTDIR}/i2c.o i2c.c 
+	@${RM} ${OBJECTDIR}/nvstore.o.d 
+	@${RM} ${OBJECTDIR}/nvstore.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/nvstore.o.d" -MT "${OBJECTDIR}/nvstore.o.d" -MT ${OBJECTDIR}/nvstore.o -o ${OBJECTDIR}/nvstore.o nvstore.c 
 	
-${OBJECTDIR}/max30102.o: max30102.c  .generated_files/flags/default/58439ed3724313582c39c26dba1f593413f74449 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/plot.o: plot.c  .generated_files/flags/default/23b13dd6c259316e2f489c91ab8876807dc55241 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/max30102.o.d 
-	@${RM} ${OBJECTDIR}/max30102.o 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/max30102.o.d" -MT "${OBJECTDIR}/max30102.o.d" -MT ${OBJECTDIR}/max30102.o -o ${OBJECTDIR}/max30102.o max30102.c 
+	@${RM} ${OBJECTDIR}/plot.o.d 
+	@${RM} ${OBJECTDIR}/plot.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -x c -D__$(MP_PROCESSOR_OPTION)__   -mdfp="${DFP_DIR}/xc8"  -Wl,--gc-sections -O1 -ffunction-sections -fdata-sections -fshort-enums -fno-common -funsigned-char -funsigned-bitfields -I"." -I"../common" -Wall -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -gdwarf-3 -mno-const-data-in-progmem     -MD -MP -MF "${OBJECTDIR}/plot.o.d" -MT "${OBJECTDIR}/plot.o.d" -MT ${OBJECTDIR}/plot.o -o ${OBJECTDIR}/plot.o plot.c 
 	
 endif
 
@@ -0,0 +1,168 @@
+/**
+ * @file nvstore.c
+ * @brief Wear-leveled EEPROM record implementation
+ * @details A slot is the sequence number, the layout version, the record and
+ *          a CRC-16/CCITT-FALSE over everything before it. Sequence numbers
+ *          count up by one per save and skip 0xFFFF, the value of erased
+ *          EEPROM. With NVSTORE_SLOTS far below 32768 the newest slot is the
+ *          one every other valid slot is behind in 16-bit serial arithmetic.
+ */
+
+#include "nvstore.h"
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+#include <string.h>
+#include <stddef.h>
+
+#define NVSTORE_SEQ_ERASED  0xFFFF
+
+typedef struct {
+    uint16_t sequence;
+    uint8_t version;
+    nvstore_record_t record;
+    uint16_t crc;
+} nvstore_slot_t;
+
+_Static_assert(sizeof(nvstore_slot_t) <= NVSTORE_SLOT_SIZE,
+               "nvstore_slot_t does not fit in NVSTORE_SLOT_SIZE");
+_Static_assert(NVSTORE_BASE + NVSTORE_SLOTS * NVSTORE_SLOT_SIZE <= 1024,
+               "nvstore slots do not fit in the EEPROM");
+
+static nvstore_record_t record;
+static bool dirty = false;              // record differs from the last save
+
+static uint8_t last_slot = NVSTORE_SLOTS - 1;   // Slot of the newest save
+static uint16_t last_sequence = 0;
+
+// Write in progress, pending is a snapshot so record can change meanwhile
+static nvstore_slot_t pending;
+static uint8_t write_slot;
+static uint8_t write_pos = 0;
+static bool writing = false;
+
+/**
+ * @brief EEPROM address of a byte in a slot
+ * @param slot Slot index
+ * @param offset Byte within the slot
+ * @return address for the avr/eeprom.h functions
+ */
+static uint8_t *nvstore_address(uint8_t slot, uint8_t offset) {
+    return (uint8_t *)(uintptr_t)(NVSTORE_BASE + (uint16_t)slot * NVSTORE_SLOT_SIZE + offset);
+}
+
+/**
+ * @brief CRC of a slot up to its crc field
+ * @param slot Slot contents
+ * @return CRC-16/CCITT-FALSE
+ */
+static uint16_t nvstore_crc(const nvstore_slot_t *slot) {
+    const uint8_t *p = (const uint8_t *)slot;
+    uint16_t crc = 0xFFFF;
+    uint8_t i;
+
+    for (i = 0; i < offsetof(nvstore_slot_t, crc); i++) {
+        crc = _crc_ccitt_update(crc, p[i]);
+    }
+    return crc;
+}
+
+/**
+ * @brief Load the newest valid record from EEPROM
+ */
+bool nvstore_init(void) {
+    nvstore_slot_t slot;
+    bool found = false;
+    uint8_t i;
+
+    for (i = 0; i < NVSTORE_SLOTS; i++) {
+        eeprom_read_block(&slot, nvstore_address(i, 0), sizeof(slot));
+        if (slot.sequence == NVSTORE_SEQ_ERASED ||
+            slot.version != NVSTORE_VERSION ||
+            slot.crc != nvstore_crc(&slot)) {
+            continue;
+        }
+        if (!found || (int16_t)(slot.sequence - last_sequence) > 0) {
+            found = true;
+            last_slot = i;
+            last_sequence = slot.sequence;
+            record = slot.record;
+        }
+    }
+
+    if (!found) {
+        memset(&record, 0, sizeof(record));
+    }
+    dirty = false;
+    writing = false;
+    return found;
+}
+
+/**
+ * @brief Current record, including changes not saved yet
+ */
+const nvstore_record_t *nvstore_get(void) {
+    return &record;
+}
+
+/**
+ * @brief Replace the RAM copy of the record
+ */
+void nvstore_set(const nvstore_record_t *new_record) {
+    if (memcmp(&record, new_record, sizeof(record)) != 0) {
+        record = *new_record;
+        dirty = true;
+    }
+}
+
+/**
+ * @brief Start writing the record to the next slot
+ */
+bool nvstore_save(void) {
+    if (!dirty || writing) {
+        return false;
+    }
+
+    last_sequence++;
+    if (last_sequence == NVSTORE_SEQ_ERASED) {
+        last_sequence++;
+    }
+    write_slot = (last_slot + 1) % NVSTORE_SLOTS;
+
+    memset(&pending, 0, sizeof(pending));
+    pending.sequence = last_sequence;
+    pending.version = NVSTORE_VERSION;
+    pending.record = record;
+    pending.crc = nvstore_crc(&pending);
+
+    write_pos = 0;
+    writing = true;
+    dirty = false;
+    return true;
+}
+
+/**
+ * @brief Check for a write in progress
+ */
+bool nvstore_busy(void) {
+    return writing;
+}
+
+/**
+ * @brief Continue a write, one changed byte at a time
+ */
+void nvstore_service(void) {
+    const uint8_t *p = (const uint8_t *)&pending;
+    uint8_t *address;
+
+    while (writing && eeprom_is_ready()) {
+        address = nvstore_address(write_slot, write_pos);
+        // Unchanged bytes cost no write cycle and no wear
+        if (eeprom_read_byte(address) != p[write_pos]) {
+            eeprom_write_byte(address, p[write_pos]);
+        }
+        if (++write_pos >= sizeof(pending)) {
+            writing = false;
+            last_slot = write_slot;
+        }
+    }
+}
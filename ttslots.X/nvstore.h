@@ -0,0 +1,79 @@
+/**
+ * @file nvstore.h
+ * @brief Wear-leveled EEPROM record of play statistics and sensor calibration
+ * @details The record lives in RAM and is written to the next of
+ *          NVSTORE_SLOTS EEPROM slots on nvstore_save(), so every slot sees
+ *          only 1/NVSTORE_SLOTS of the writes. Each slot carries a sequence
+ *          number and a CRC. At boot the newest slot with a good CRC wins, a
+ *          write cut short by a reset leaves the previous slot in charge.
+ *          Writes go out one byte per nvstore_service() call and never wait
+ *          for the 3.3 ms EEPROM write cycle.
+ */
+
+#ifndef NVSTORE_H
+#define NVSTORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "max30102.h"
+
+// Layout of the EEPROM, the ATmega328PB has 1 KB
+#define NVSTORE_BASE        0       // First byte used
+#define NVSTORE_SLOT_SIZE   32      // Bytes per slot, holds one nvstore_slot_t
+#define NVSTORE_SLOTS       32      // Slots the writes rotate through
+
+// Bump when nvstore_record_t changes, older slots are then ignored
+#define NVSTORE_VERSION     1
+
+// Everything kept across power cycles
+typedef struct {
+    uint32_t spins;                 // Games played
+    uint32_t wins;                  // Games won, jackpots included
+    uint32_t jackpots;              // Games won with a jackpot
+    uint32_t hr_sum;                // Sum of the heart rates the games used, BPM
+    max30102_led_amplitude_t led;   // LED currents the last game ended on
+    uint8_t adc_range;              // max30102_adc_range_t the last game ended on
+    uint32_t rng_seed;              // Mixed into the generator at boot
+} nvstore_record_t;
+
+/**
+ * @brief Load the newest valid record from EEPROM
+ * @return true if one was found, false if the record starts out zeroed
+ */
+bool nvstore_init(void);
+
+/**
+ * @brief Current record, including changes not saved yet
+ * @return pointer to the RAM copy
+ */
+const nvstore_record_t *nvstore_get(void);
+
+/**
+ * @brief Replace the RAM copy of the record
+ * @param new_record New contents, marked for the next nvstore_save()
+ * @return none
+ */
+void nvstore_set(const nvstore_record_t *new_record);
+
+/**
+ * @brief Start writing the record to the next slot
+ * @return true if a write was started, false if nothing changed since the
+ *         last save or the previous write is still running
+ */
+bool nvstore_save(void);
+
+/**
+ * @brief Check for a write in progress
+ * @return true until the last byte of the slot has been handed to the EEPROM
+ */
+bool nvstore_busy(void);
+
+/**
+ * @brief Continue a write, call periodically from main context
+ * @return none
+ * @note Writes at most one changed byte per call, returns at once while the
+ *       EEPROM is busy
+ */
+void nvstore_service(void);
+
+#endif /* NVSTORE_H */
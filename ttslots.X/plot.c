@@ -0,0 +1,178 @@
+/*
+ * plot.c
+ *
+ * The IR channel is plotted with its DC level removed and scaled to a
+ * slowly decaying peak envelope, so it fills the plot whatever the finger
+ * and the AGC settings. More blood means less IR light, so a beat is drawn
+ * upwards. A column covers the minimum and maximum of its samples and joins
+ * the last sample of the previous column, which keeps the trace connected.
+ * Samples left over from a batch start the next column.
+ */
+
+#include "plot.h"
+#include "ST7735.h"
+#include "LCD_GFX.h"
+
+#if (PLOT_PENDING & (PLOT_PENDING - 1)) != 0
+#error "PLOT_PENDING must be a power of two"
+#endif
+
+typedef struct {
+    uint8_t top;                            // First lit row
+    uint8_t bottom;                         // Last lit row
+} plotColumn_t;
+
+static uint8_t plotLeft, plotTop, plotRight, plotBottom;
+static uint8_t cursor;                      // Column the next span goes to
+static uint8_t lastRow;                     // Row of the previous column's last sample
+
+// Column being collected, it can span several batches
+static uint32_t columnSum, columnLow, columnHigh, columnLast;
+static uint8_t columnCount;
+
+static int32_t dcLevel;                     // Running IR DC level in counts
+static uint32_t envelope;                   // Swing mapped to half the plot height
+static uint8_t primed;                      // dcLevel holds a real estimate
+
+static plotColumn_t pending[PLOT_PENDING];
+static uint8_t pendingHead, pendingTail;
+
+/**************************************************************************//**
+* @fn			static uint8_t plot_row(int32_t ac)
+* @brief		Screen row of an AC value, clipped to the plot
+* @note			Larger IR readings go down, so beats point up
+*****************************************************************************/
+static uint8_t plot_row(int32_t ac)
+{
+    int16_t half = (plotBottom - plotTop) >> 1;
+    int16_t row = ((plotTop + plotBottom) >> 1) + (int16_t)(ac * half / (int32_t)envelope);
+
+    if (row < plotTop) {
+        return plotTop;
+    }
+    if (row > plotBottom) {
+        return plotBottom;
+    }
+    return row;
+}
+
+/**************************************************************************//**
+* @fn			void plot_begin(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+* @brief		Frame an empty plot and restart the trace at the left edge
+* @note			The area must be blank, the frame goes one pixel outside it
+*****************************************************************************/
+void plot_begin(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+    plotLeft = x0;
+    plotTop = y0;
+    plotRight = x1;
+    plotBottom = y1;
+    cursor = x0;
+    lastRow = (y0 + y1) >> 1;
+    envelope = PLOT_MIN_SWING;
+    primed = 0;
+    columnCount = 0;
+    pendingHead = pendingTail = 0;
+
+    LCD_drawBlock(x0 - 1, y0 - 1, x1 + 1, y0 - 1, PLOT_FRAME_COLOR);
+    LCD_drawBlock(x0 - 1, y1 + 1, x1 + 1, y1 + 1, PLOT_FRAME_COLOR);
+    LCD_drawBlock(x0 - 1, y0, x0 - 1, y1, PLOT_FRAME_COLOR);
+    LCD_drawBlock(x1 + 1, y0, x1 + 1, y1, PLOT_FRAME_COLOR);
+}
+
+/**************************************************************************//**
+* @fn			static void plot_closeColumn(void)
+* @brief		Turn the collected PLOT_COLUMN_SAMPLES samples into a queued column
+* @note			A column that finds the queue full is dropped
+*****************************************************************************/
+static void plot_closeColumn(void)
+{
+    int32_t mean = (int32_t)(columnSum / PLOT_COLUMN_SAMPLES);
+    int32_t acLow, acHigh;
+    uint32_t swing;
+    uint8_t next, spanTop, spanBottom;
+
+    // Follow the DC level, the first column sets it outright
+    if (!primed) {
+        dcLevel = mean;
+        primed = 1;
+    }
+    dcLevel += (mean - dcLevel) >> PLOT_DC_SHIFT;
+    acLow = (int32_t)columnLow - dcLevel;
+    acHigh = (int32_t)columnHigh - dcLevel;
+
+    // Grow the scale at once for a bigger swing, shrink it slowly
+    swing = (acHigh > -acLow) ? (uint32_t)acHigh : (uint32_t)-acLow;
+    envelope -= envelope >> PLOT_ENVELOPE_SHIFT;
+    if (swing > envelope) envelope = swing;
+    if (envelope < PLOT_MIN_SWING) envelope = PLOT_MIN_SWING;
+
+    // Rows run the other way round, the lowest reading is the top row.
+    // Reach back to where the previous column ended.
+    spanTop = plot_row(acLow);
+    spanBottom = plot_row(acHigh);
+    if (lastRow < spanTop) spanTop = lastRow;
+    if (lastRow > spanBottom) spanBottom = lastRow;
+    lastRow = plot_row((int32_t)columnLast - dcLevel);
+
+    next = (pendingHead + 1) & (PLOT_PENDING - 1);
+    if (next == pendingTail) {
+        return;
+    }
+    pending[pendingHead].top = spanTop;
+    pending[pendingHead].bottom = spanBottom;
+    pendingHead = next;
+}
+
+/**************************************************************************//**
+* @fn			void plot_addSamples(const max30102_fifo_sample_t *samples, uint8_t count)
+* @brief		Collect samples, queueing a column for every PLOT_COLUMN_SAMPLES
+* @note			No LCD traffic, safe to call from the sensor task. Batches of
+*				any size can be passed, the remainder carries over.
+*****************************************************************************/
+void plot_addSamples(const max30102_fifo_sample_t *samples, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++) {
+        uint32_t ir = samples[i].ir;
+
+        if (columnCount == 0) {
+            columnSum = 0;
+            columnLow = UINT32_MAX;
+            columnHigh = 0;
+        }
+        columnSum += ir;
+        if (ir < columnLow) columnLow = ir;
+        if (ir > columnHigh) columnHigh = ir;
+        columnLast = ir;
+
+        if (++columnCount == PLOT_COLUMN_SAMPLES) {
+            plot_closeColumn();
+            columnCount = 0;
+        }
+    }
+}
+
+/**************************************************************************//**
+* @fn			void plot_update(void)
+* @brief		Draw the queued columns and move the sweep cursor along
+* @note			Each column is one address window of plot height: background,
+*				the lit span, background
+*****************************************************************************/
+void plot_update(void)
+{
+    while (pendingTail != pendingHead) {
+        const plotColumn_t *column = &pending[pendingTail];
+
+        LCD_openWindow(cursor, plotTop, cursor, plotBottom);
+        LCD_pushColor(BLACK, column->top - plotTop);
+        LCD_pushColor(PLOT_TRACE_COLOR, column->bottom - column->top + 1);
+        LCD_pushColor(BLACK, plotBottom - column->bottom);
+        LCD_closeWindow();
+
+        // Blank the next column, the gap shows where the sweep is
+        cursor = (cursor == plotRight) ? plotLeft : cursor + 1;
+        LCD_drawBlock(cursor, plotTop, cursor, plotBottom, BLACK);
+
+        pendingTail = (pendingTail + 1) & (PLOT_PENDING - 1);
+    }
+}
@@ -0,0 +1,31 @@
+/*
+ * plot.h
+ *
+ * Sweeping PPG trace for the measuring screen. Every PLOT_COLUMN_SAMPLES
+ * samples become one column, whatever batches they arrive in, so the time
+ * axis is even. A column is drawn as a single vertical span in its own
+ * address window, with a blank column ahead of it as the sweep cursor.
+ * Columns are queued by the sensor task and drawn later by the animation
+ * task, so the sensor never waits for the LCD.
+ */
+
+#ifndef PLOT_H_
+#define PLOT_H_
+
+#include <stdint.h>
+#include "max30102.h"
+
+#define PLOT_TRACE_COLOR    GREEN
+#define PLOT_FRAME_COLOR    BLUE
+
+#define PLOT_COLUMN_SAMPLES 10   // Samples per column, 100 ms at 100 Hz
+#define PLOT_PENDING        8    // Columns queued between draws, a power of two
+#define PLOT_DC_SHIFT       4    // DC tracking, 1/16 of the error per column
+#define PLOT_ENVELOPE_SHIFT 5    // Scale decay, 1/32 per column
+#define PLOT_MIN_SWING      64   // Smallest swing in counts scaled to full height
+
+void plot_begin(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void plot_addSamples(const max30102_fifo_sample_t *samples, uint8_t count);
+void plot_update(void);
+
+#endif /* PLOT_H_ */
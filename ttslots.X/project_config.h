@@ -0,0 +1,22 @@
+/**
+ * @file project_config.h
+ * @brief Shared driver settings for the slot machine firmware
+ * @details Included first by common/drivers_config.h, anything left
+ *          undefined here takes the default from there
+ */
+
+#ifndef PROJECT_CONFIG_H
+#define PROJECT_CONFIG_H
+
+#define F_CPU 16000000UL
+
+// Status lines are dropped rather than stalling the reel animation
+#define UART_TX_OVERFLOW UART_TX_DROP
+
+// Delta-coded sample ring, 128 samples in the SRAM of 64
+#define MAX30102_RING_DELTA 1
+
+// 1 reports draw time per screen over UART, see LCD_GFX.h
+#define LCD_PROFILE 0
+
+#endif /* PROJECT_CONFIG_H */
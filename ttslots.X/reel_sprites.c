@@ -0,0 +1,82 @@
+/*
+ * reel_sprites.c
+ *
+ * Generated by tools/png2sprite.py, do not edit.
+ * Regenerate with: png2sprite.py -o reel_sprites reel_seven=../tools/art/reel_seven.png reel_dollar=../tools/art/reel_dollar.png reel_bar=../tools/art/reel_bar.png reel_cherry=../tools/art/reel_cherry.png
+ */
+
+#include <avr/pgmspace.h>
+#include "reel_sprites.h"
+
+// reel_seven: 16x16 from reel_seven.png
+static const uint16_t reel_seven_palette[3] PROGMEM = {
+    0x001F, 0x8800, 0xE0A2
+};
+
+static const uint8_t reel_seven_runs[55] PROGMEM = {
+    0xF0, 0x00, 0xD1, 0x10, 0x01, 0xB2, 0x01, 0x10, 0x01, 0xB2, 0x01, 0x10,
+    0x81, 0x32, 0x01, 0x80, 0x01, 0x32, 0x01, 0x80, 0x01, 0x32, 0x01, 0x80,
+    0x01, 0x32, 0x01, 0x90, 0x01, 0x22, 0x01, 0x90, 0x01, 0x32, 0x01, 0x90,
+    0x01, 0x22, 0x01, 0x90, 0x01, 0x32, 0x01, 0x90, 0x01, 0x32, 0x01, 0x90,
+    0x01, 0x32, 0x01, 0x90, 0x51, 0xF0, 0x50,
+};
+
+const LCD_sprite_t reel_seven PROGMEM = {
+    16, 16, 3, reel_seven_palette, reel_seven_runs, 55
+};
+
+// reel_dollar: 16x16 from reel_dollar.png
+static const uint16_t reel_dollar_palette[3] PROGMEM = {
+    0x001F, 0x0363, 0x1647
+};
+
+static const uint8_t reel_dollar_runs[75] PROGMEM = {
+    0x60, 0x11, 0xA0, 0x21, 0x12, 0x21, 0x60, 0x01, 0x72, 0x01, 0x40, 0x01,
+    0x12, 0x01, 0x12, 0x11, 0x22, 0x01, 0x30, 0x01, 0x12, 0x11, 0x02, 0x01,
+    0x10, 0x11, 0x40, 0x01, 0x22, 0x01, 0x02, 0x01, 0x90, 0x01, 0x42, 0x11,
+    0x80, 0x11, 0x52, 0x01, 0x90, 0x01, 0x02, 0x01, 0x22, 0x01, 0x40, 0x11,
+    0x10, 0x01, 0x02, 0x11, 0x12, 0x01, 0x30, 0x01, 0x22, 0x11, 0x02, 0x01,
+    0x22, 0x01, 0x40, 0x01, 0x72, 0x01, 0x60, 0x21, 0x12, 0x21, 0xA0, 0x11,
+    0xF0, 0xF0, 0x60,
+};
+
+const LCD_sprite_t reel_dollar PROGMEM = {
+    16, 16, 3, reel_dollar_palette, reel_dollar_runs, 75
+};
+
+// reel_bar: 16x16 from reel_bar.png
+static const uint16_t reel_bar_palette[4] PROGMEM = {
+    0x001F, 0xABC0, 0xFE80, 0x10A2
+};
+
+static const uint8_t reel_bar_runs[70] PROGMEM = {
+    0xF0, 0xF0, 0xF1, 0x01, 0xD2, 0x11, 0x02, 0x23, 0x12, 0x13, 0x12, 0x23,
+    0x02, 0x11, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x12, 0x03, 0x02, 0x03,
+    0x02, 0x03, 0x02, 0x11, 0x02, 0x13, 0x12, 0x03, 0x12, 0x03, 0x02, 0x13,
+    0x12, 0x11, 0x02, 0x03, 0x02, 0x03, 0x02, 0x33, 0x02, 0x03, 0x02, 0x03,
+    0x02, 0x11, 0x02, 0x23, 0x02, 0x03, 0x12, 0x03, 0x02, 0x03, 0x02, 0x03,
+    0x02, 0x11, 0xD2, 0xF1, 0x01, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+};
+
+const LCD_sprite_t reel_bar PROGMEM = {
+    16, 16, 4, reel_bar_palette, reel_bar_runs, 70
+};
+
+// reel_cherry: 16x16 from reel_cherry.png
+static const uint16_t reel_cherry_palette[6] PROGMEM = {
+    0x001F, 0x0363, 0x2D05, 0x8800, 0xE0A2, 0xFFFF
+};
+
+static const uint8_t reel_cherry_runs[83] PROGMEM = {
+    0x90, 0x11, 0xC0, 0x01, 0x02, 0x01, 0xB0, 0x01, 0x12, 0x11, 0x90, 0x01,
+    0x02, 0x10, 0x01, 0x02, 0x01, 0x70, 0x01, 0x02, 0x30, 0x11, 0x60, 0x01,
+    0x02, 0x40, 0x01, 0x02, 0x50, 0x01, 0x02, 0x50, 0x01, 0x02, 0x30, 0x33,
+    0x40, 0x33, 0x10, 0x03, 0x34, 0x03, 0x20, 0x03, 0x34, 0x13, 0x04, 0x05,
+    0x34, 0x03, 0x00, 0x03, 0x04, 0x05, 0x24, 0x13, 0x54, 0x03, 0x00, 0x03,
+    0x44, 0x13, 0x54, 0x03, 0x00, 0x03, 0x44, 0x03, 0x00, 0x03, 0x34, 0x03,
+    0x20, 0x03, 0x24, 0x03, 0x20, 0x33, 0x40, 0x23, 0xF0, 0xF0, 0x10,
+};
+
+const LCD_sprite_t reel_cherry PROGMEM = {
+    16, 16, 6, reel_cherry_palette, reel_cherry_runs, 83
+};
@@ -0,0 +1,18 @@
+/*
+ * reel_sprites.h
+ *
+ * Generated by tools/png2sprite.py, do not edit.
+ * Regenerate with: png2sprite.py -o reel_sprites reel_seven=../tools/art/reel_seven.png reel_dollar=../tools/art/reel_dollar.png reel_bar=../tools/art/reel_bar.png reel_cherry=../tools/art/reel_cherry.png
+ */
+
+#ifndef REEL_SPRITES_H_
+#define REEL_SPRITES_H_
+
+#include "LCD_GFX.h"
+
+extern const LCD_sprite_t reel_seven PROGMEM;  // 16x16, 3 colors, 55 runs
+extern const LCD_sprite_t reel_dollar PROGMEM;  // 16x16, 3 colors, 75 runs
+extern const LCD_sprite_t reel_bar PROGMEM;  // 16x16, 4 colors, 70 runs
+extern const LCD_sprite_t reel_cherry PROGMEM;  // 16x16, 6 colors, 83 runs
+
+#endif /* REEL_SPRITES_H_ */
@@ -0,0 +1,81 @@
+/*
+ * reels.c
+ *
+ * Dirty-cell reel renderer. reels_begin() draws the reel boxes once, after
+ * that reels_update() only retransmits the symbol cell of a wheel whose
+ * symbol differs from the one already on the panel.
+ */
+
+#include "reels.h"
+#include "LCD_GFX.h"
+#include "reel_sprites.h"
+
+#define REEL_NONE 0xFF
+
+// Symbol artwork in flash, in the order of the old '7', '$', '#', '@' glyphs
+static const LCD_sprite_t *const reelSymbols[REEL_SYMBOL_COUNT] = {
+    &reel_seven, &reel_dollar, &reel_bar, &reel_cherry
+};
+
+static uint8_t symbolY;                     // Top row of the symbol cells
+static uint8_t shown[REEL_COUNT];           // Symbol currently on the panel
+static uint8_t wanted[REEL_COUNT];          // Symbol to show on next update
+
+/**************************************************************************//**
+* @fn			void reels_begin(uint8_t top, uint8_t bottom)
+* @brief		Draw the reel boxes and forget what was on the panel before
+* @note			Call once when a screen with reels is entered
+*****************************************************************************/
+void reels_begin(uint8_t top, uint8_t bottom)
+{
+    symbolY = ((top + bottom) >> 1) - (REEL_SPRITE_SIZE / 2);
+
+    for (uint8_t wheel = 0; wheel < REEL_COUNT; wheel++) {
+        uint8_t x = REEL_FIRST_X + wheel * REEL_SPACING;
+        LCD_drawBlock(x - REEL_HALF_WIDTH, top, x + REEL_HALF_WIDTH, bottom, REEL_COLOR);
+
+        // Box is blank, so the first update has to draw every symbol
+        shown[wheel] = REEL_NONE;
+        wanted[wheel] = 0;
+    }
+}
+
+/**************************************************************************//**
+* @fn			void reels_setSymbol(uint8_t wheel, uint8_t symbol)
+* @brief		Select the symbol a wheel should show on the next update
+* @note
+*****************************************************************************/
+void reels_setSymbol(uint8_t wheel, uint8_t symbol)
+{
+    if (wheel < REEL_COUNT && symbol < REEL_SYMBOL_COUNT) {
+        wanted[wheel] = symbol;
+    }
+}
+
+/**************************************************************************//**
+* @fn			uint8_t reels_getSymbol(uint8_t wheel)
+* @brief		Symbol a wheel was last set to
+* @note
+*****************************************************************************/
+uint8_t reels_getSymbol(uint8_t wheel)
+{
+    return wanted[wheel];
+}
+
+/**************************************************************************//**
+* @fn			void reels_update(void)
+* @brief		Redraw the symbol cell of every wheel that changed
+* @note			Each changed cell costs one RLE sprite in a 16x16 address window
+*****************************************************************************/
+void reels_update(void)
+{
+    for (uint8_t wheel = 0; wheel < REEL_COUNT; wheel++) {
+        if (shown[wheel] == wanted[wheel]) {
+            continue;
+        }
+
+        uint8_t x = REEL_FIRST_X + wheel * REEL_SPACING;
+        LCD_drawBitmapRLE(x - (REEL_SPRITE_SIZE / 2), symbolY, reelSymbols[wanted[wheel]]);
+        shown[wheel] = wanted[wheel];
+    }
+}
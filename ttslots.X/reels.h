@@ -0,0 +1,28 @@
+/*
+ * reels.h
+ *
+ * Reel renderer for the slot machine screens. Keeps track of what is
+ * already on the panel so only the symbol cells that changed get resent.
+ */
+
+#ifndef REELS_H_
+#define REELS_H_
+
+#include <stdint.h>
+
+#define REEL_COUNT          3
+#define REEL_SYMBOL_COUNT   4
+
+#define REEL_SPACING        40   // Distance between reel centres
+#define REEL_FIRST_X        40   // Centre of the left reel
+#define REEL_HALF_WIDTH     10
+#define REEL_SPRITE_SIZE    16   // Symbol artwork is 16x16, see reel_sprites.c
+
+#define REEL_COLOR          BLUE
+
+void reels_begin(uint8_t top, uint8_t bottom);
+void reels_setSymbol(uint8_t wheel, uint8_t symbol);
+void reels_update(void);
+uint8_t reels_getSymbol(uint8_t wheel);
+
+#endif /* REELS_H_ */
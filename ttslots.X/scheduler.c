@@ -0,0 +1,194 @@
+/**
+ * @file scheduler.c
+ * @brief Millisecond system tick and cooperative task scheduler implementation
+ * @details Timer2 runs in CTC mode at F_CPU/64 with OCR2A = 249, giving one
+ *          compare match every millisecond.
+ */
+#include "drivers_config.h"
+#include "scheduler.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <util/atomic.h>
+
+#define SCHEDULER_TICK_TOP  ((F_CPU / 64 / 1000) - 1)
+#define SCHEDULER_US_PER_COUNT  (64000000UL / F_CPU)
+
+typedef struct {
+    scheduler_task_t task;
+    uint16_t period_ms;
+    uint32_t next_ms;       // Deadline of the next run
+} scheduler_entry_t;
+
+static volatile uint32_t tick_ms = 0;
+static scheduler_entry_t tasks[SCHEDULER_MAX_TASKS];
+static uint8_t task_count = 0;
+static uint32_t idle_ms = 0;            // Time asleep, whole milliseconds
+static uint32_t idle_us = 0;            // Remainder below one millisecond
+
+static bool scheduler_due(void);
+
+/**
+ * @brief Start the 1 ms system tick on Timer2
+ */
+void scheduler_init(void) {
+    TCCR2A = (1 << WGM21);                  // CTC mode, TOP = OCR2A
+    OCR2A = SCHEDULER_TICK_TOP;
+    TCNT2 = 0;
+    TIFR2 = (1 << OCF2A);
+    TIMSK2 = (1 << OCIE2A);
+    TCCR2B = (1 << CS22);                   // clk/64
+}
+
+/**
+ * @brief Milliseconds since scheduler_init()
+ * @return current tick count
+ */
+uint32_t scheduler_millis(void) {
+    uint32_t now;
+    
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        now = tick_ms;
+    }
+    
+    return now;
+}
+
+/**
+ * @brief Microseconds since scheduler_init(), 4 us resolution
+ * @return current time, wraps after about 71 minutes
+ */
+uint32_t scheduler_micros(void) {
+    uint32_t ms;
+    uint8_t count;
+    
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        ms = tick_ms;
+        count = TCNT2;
+        
+        // The counter already wrapped but the tick has not been counted yet
+        if ((TIFR2 & (1 << OCF2A)) && count < SCHEDULER_TICK_TOP) {
+            ms++;
+        }
+    }
+    
+    return ms * 1000 + (uint16_t)count * SCHEDULER_US_PER_COUNT;
+}
+
+/**
+ * @brief Register a periodic task
+ * @param task Function to run
+ * @param period_ms Time between runs in milliseconds
+ * @return task id, or SCHEDULER_INVALID_TASK if the table is full
+ */
+uint8_t scheduler_add(scheduler_task_t task, uint16_t period_ms) {
+    if (task == 0 || task_count >= SCHEDULER_MAX_TASKS) {
+        return SCHEDULER_INVALID_TASK;
+    }
+    
+    tasks[task_count].task = task;
+    tasks[task_count].period_ms = period_ms;
+    tasks[task_count].next_ms = scheduler_millis();     // First run right away
+    
+    return task_count++;
+}
+
+/**
+ * @brief Change the period of a task and restart its deadline
+ * @param id Task id returned by scheduler_add()
+ * @param period_ms New period in milliseconds
+ */
+void scheduler_set_period(uint8_t id, uint16_t period_ms) {
+    if (id >= task_count) {
+        return;
+    }
+    
+    tasks[id].period_ms = period_ms;
+    tasks[id].next_ms = scheduler_millis();
+}
+
+/**
+ * @brief Run every task whose deadline has passed
+ * @return true if at least one task ran, false otherwise
+ */
+bool scheduler_run(void) {
+    bool ran = false;
+    
+    for (uint8_t i = 0; i < task_count; i++) {
+        uint32_t now = scheduler_millis();
+        
+        // Signed difference keeps working across tick wraparound
+        if ((int32_t)(now - tasks[i].next_ms) < 0) {
+            continue;
+        }
+        
+        // Advance by whole periods so the task does not drift, but skip
+        // missed runs instead of bursting to catch up
+        tasks[i].next_ms += tasks[i].period_ms;
+        if ((int32_t)(now - tasks[i].next_ms) >= 0) {
+            tasks[i].next_ms = now + tasks[i].period_ms;
+        }
+        
+        tasks[i].task();
+        ran = true;
+    }
+    
+    return ran;
+}
+
+/**
+ * @brief Sleep in IDLE mode until the next interrupt if no task is due
+ */
+void scheduler_idle(void) {
+    uint32_t start = scheduler_micros();
+    
+    // Interrupts stay off between the check and SLEEP, so a tick cannot
+    // make a task due unnoticed. The instruction after SEI always runs
+    // before a pending interrupt is taken.
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    cli();
+    if (scheduler_due()) {
+        sei();
+        return;
+    }
+    sleep_enable();
+    sei();
+    sleep_cpu();
+    sleep_disable();
+    
+    idle_us += scheduler_micros() - start;
+    while (idle_us >= 1000) {
+        idle_us -= 1000;
+        idle_ms++;
+    }
+}
+
+/**
+ * @brief Total time spent asleep in scheduler_idle()
+ * @return idle time in milliseconds
+ */
+uint32_t scheduler_idle_millis(void) {
+    return idle_ms;
+}
+
+/**
+ * @brief Check if any task deadline has passed
+ * @return true if scheduler_run() would run a task
+ * @note Called with interrupts disabled
+ */
+static bool scheduler_due(void) {
+    for (uint8_t i = 0; i < task_count; i++) {
+        if ((int32_t)(tick_ms - tasks[i].next_ms) >= 0) {
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+/**
+ * @brief Timer2 compare match: 1 ms system tick
+ */
+ISR(TIMER2_COMPA_vect) {
+    tick_ms++;
+}
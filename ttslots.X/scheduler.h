@@ -0,0 +1,79 @@
+/**
+ * @file scheduler.h
+ * @brief Millisecond system tick and cooperative task scheduler for ATMEGA328PB
+ * @details Timer2 generates a 1 ms tick. Tasks are plain functions that run to
+ *          completion, each with its own period. scheduler_run() is called from
+ *          the main loop and runs every task whose deadline has passed, then
+ *          scheduler_idle() sleeps until the next interrupt.
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Maximum number of registered tasks
+#define SCHEDULER_MAX_TASKS     6
+
+// Returned by scheduler_add() when the task table is full
+#define SCHEDULER_INVALID_TASK  0xFF
+
+// Task entry point, must return quickly
+typedef void (*scheduler_task_t)(void);
+
+/**
+ * @brief Start the 1 ms system tick on Timer2
+ * @return none
+ */
+void scheduler_init(void);
+
+/**
+ * @brief Milliseconds since scheduler_init()
+ * @return current tick count
+ */
+uint32_t scheduler_millis(void);
+
+/**
+ * @brief Microseconds since scheduler_init(), 4 us resolution
+ * @return current time, wraps after about 71 minutes
+ */
+uint32_t scheduler_micros(void);
+
+/**
+ * @brief Register a periodic task
+ * @param task Function to run
+ * @param period_ms Time between runs in milliseconds
+ * @return task id, or SCHEDULER_INVALID_TASK if the table is full
+ */
+uint8_t scheduler_add(scheduler_task_t task, uint16_t period_ms);
+
+/**
+ * @brief Change the period of a task and restart its deadline
+ * @param id Task id returned by scheduler_add()
+ * @param period_ms New period in milliseconds
+ * @return none
+ */
+void scheduler_set_period(uint8_t id, uint16_t period_ms);
+
+/**
+ * @brief Run every task whose deadline has passed
+ * @return true if at least one task ran, false otherwise
+ */
+bool scheduler_run(void);
+
+/**
+ * @brief Sleep in IDLE mode until the next interrupt if no task is due
+ * @return none
+ * @note Timers, SPI, TWI and USART keep running in IDLE and any of their
+ *       interrupts wake the CPU, the 1 ms tick bounds the sleep
+ */
+void scheduler_idle(void);
+
+/**
+ * @brief Total time spent asleep in scheduler_idle()
+ * @return idle time in milliseconds
+ */
+uint32_t scheduler_idle_millis(void);
+
+#endif /* SCHEDULER_H */